@@ -0,0 +1,118 @@
+/**
+  * @file   aligned.h
+  * @author Dylan Warren, Section A
+  * @brief  One zeroed heap block aligned for vector loads.
+*/
+/**
+  * @class  AlignedBuffer
+  * @brief  AlignedBuffer owns size values starting on a 64 byte boundary,
+  *         a cache line and a full AVX-512 register. It is for plain number
+  *         types only, nothing is constructed or destroyed in place.
+*/
+#ifndef ALIGNED_H
+#define ALIGNED_H
+
+#include <new>
+#include <cstddef>
+
+template<class T>
+class AlignedBuffer
+{
+  private:
+    T* m_data;
+    int m_size;
+    /**
+      * @brief   Gets a zeroed aligned block
+      * @pre     size must be greater than zero
+      * @post    None
+      * @param   size - How many values
+      * @return  The block
+    */
+    static T* allocate(const int size);
+    /**
+      * @brief   Gives a block from allocate back
+      * @pre     data came from allocate or is nullptr
+      * @post    data is freed
+      * @param   data - Block to free
+      * @return  None
+    */
+    static void release(T* data);
+  public:
+    /** Alignment of data() in bytes */
+    static const std::size_t ALIGNMENT = 64;
+    /**
+      * @brief   Makes an empty buffer
+      * @pre     None
+      * @post    data() is nullptr
+      * @return  None
+    */
+    AlignedBuffer() : m_data(nullptr), m_size(0) {};
+    /**
+      * @brief   Allocates size zeroed values
+      * @pre     size must not be negative or more than an int holds
+      * @post    Creates a buffer, empty if size is 0
+      * @param   size - How many values, callers work it out in a wider type
+                  so an overflowed count is caught here
+      * @return  None
+      * @throw   If size is negative or more than an int holds
+    */
+    AlignedBuffer(const std::ptrdiff_t size);
+    /**
+      * @brief   Copies source into a new block
+      * @pre     None
+      * @post    Creates a buffer identical to source
+      * @param   source - AlignedBuffer to copy
+      * @return  None
+    */
+    AlignedBuffer(const AlignedBuffer& source);
+    /**
+      * @brief   Takes the block of other
+      * @pre     None
+      * @post    other is empty
+      * @param   other - AlignedBuffer to move
+      * @return  None
+    */
+    AlignedBuffer(AlignedBuffer&& other);
+    /**
+      * @brief   Copies rhs, reusing the block when the sizes match
+      * @pre     None
+      * @post    The C.O is identical to rhs
+      * @param   rhs - AlignedBuffer to copy
+      * @return  *this as the C.O is being altered
+    */
+    AlignedBuffer& operator=(const AlignedBuffer& rhs);
+    /**
+      * @brief   Swaps blocks with other
+      * @pre     None
+      * @post    The C.O holds what other held
+      * @param   other - AlignedBuffer to move
+      * @return  *this as the C.O is being altered
+    */
+    AlignedBuffer& operator=(AlignedBuffer&& other);
+    /**
+      * @brief   Frees the block
+      * @pre     None
+      * @post    None
+      * @return  None
+    */
+    ~AlignedBuffer() { release(m_data); }
+    /**
+      * @brief   Gets how many values the buffer holds
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getSize() const { return m_size; }
+    /**
+      * @brief   Gets the first value, 64 byte aligned
+      * @pre     None
+      * @post    None
+      * @return  m_data
+    */
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+};
+
+#include "./aligned.hpp"
+
+#endif
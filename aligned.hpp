@@ -0,0 +1,108 @@
+/**
+  * @file   aligned.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines AlignedBuffer functions
+*/
+#include <exception>
+#include <stdexcept>
+#include <iostream>
+#include <climits>
+
+template<typename T>
+T* AlignedBuffer<T>::allocate(const int size)
+{
+  T* data = static_cast<T*>(::operator new[](sizeof(T) * static_cast<std::size_t>(size),
+                                             std::align_val_t(ALIGNMENT)));
+  for(int i = 0; i < size; i++)
+  {
+    data[i] = 0;
+  }
+  return data;
+}
+
+template<typename T>
+void AlignedBuffer<T>::release(T* data)
+{
+  if(data != nullptr)
+  {
+    ::operator delete[](data, std::align_val_t(ALIGNMENT));
+  }
+}
+
+template<typename T>
+AlignedBuffer<T>::AlignedBuffer(const std::ptrdiff_t size)
+{
+  if(size < 0)
+  {
+    std::cerr << "Buffer size must not be negative" << std::endl;
+    throw std::out_of_range("NEGATIVE SIZE; ALIGNED BUFFER");
+  }
+  if(size > INT_MAX)
+  {
+    std::cerr << "Buffer size does not fit in an int" << std::endl;
+    throw std::out_of_range("TOO LARGE; ALIGNED BUFFER");
+  }
+
+  m_size = static_cast<int>(size);
+  m_data = (m_size > 0 ? allocate(m_size) : nullptr);
+}
+
+template<typename T>
+AlignedBuffer<T>::AlignedBuffer(const AlignedBuffer& source)
+{
+  m_size = source.m_size;
+  m_data = (m_size > 0 ? allocate(m_size) : nullptr);
+  for(int i = 0; i < m_size; i++)
+  {
+    m_data[i] = source.m_data[i];
+  }
+}
+
+template<typename T>
+AlignedBuffer<T>::AlignedBuffer(AlignedBuffer&& other)
+{
+  m_data = other.m_data;
+  m_size = other.m_size;
+  other.m_data = nullptr;
+  other.m_size = 0;
+}
+
+template<typename T>
+AlignedBuffer<T>& AlignedBuffer<T>::operator=(const AlignedBuffer& rhs)
+{
+  if(this != &rhs)
+  {
+    // A new block is filled before the old one is let go, so a failed
+    // allocation leaves the C.O as it was
+    T* data = m_data;
+    if(m_size != rhs.m_size)
+    {
+      data = (rhs.m_size > 0 ? allocate(rhs.m_size) : nullptr);
+    }
+    for(int i = 0; i < rhs.m_size; i++)
+    {
+      data[i] = rhs.m_data[i];
+    }
+    if(data != m_data)
+    {
+      release(m_data);
+      m_data = data;
+      m_size = rhs.m_size;
+    }
+  }
+
+  return *this;
+}
+
+template<typename T>
+AlignedBuffer<T>& AlignedBuffer<T>::operator=(AlignedBuffer&& other)
+{
+  T* data = m_data;
+  const int size = m_size;
+  m_data = other.m_data;
+  m_size = other.m_size;
+  other.m_data = data;
+  other.m_size = size;
+
+  return *this;
+}
@@ -0,0 +1,160 @@
+/**
+  * @file   band.h
+  * @author Dylan Warren, Section A
+  * @brief  The band class is a symmetric banded matrix.
+*/
+/**
+  * @class  BandSymMatrix
+  * @brief  BandSymMatrix only stores the diagonal and the band entries to its
+  *         left, every other entry is 0. Cholesky fill stays inside the band,
+  *         so it can be factored in place.
+*/
+
+#ifndef BAND_H
+#define BAND_H
+
+#include "./matrix.h"
+
+template<class T>
+class BandSymMatrix : public matrix<BandSymMatrix<T>, T>
+{
+  private:
+    int m_size;
+    int m_band;
+    vector<T> ptr_to_data;
+  public:
+    /**
+      * @brief   Sets size and band to 0 and leaves the storage empty
+      * @pre     None
+      * @post    All member variables are set.
+      * @return  None
+    */
+    BandSymMatrix() : m_size(0), m_band(0), ptr_to_data(vector<T>()) {};
+    /**
+      * @brief   Confirms size and band are proper values then makes room for
+                  size * (band + 1) entries, all set to 0
+      * @pre     size must be greater than zero and band zero or greater
+      * @post    Creates a fresh size by size BandSymMatrix
+      * @param   size - Rows and cols of the BandSymMatrix
+      * @param   band - Half bandwidth, entries with |row - col| > band are 0
+      * @return  None
+      * @throw   If size is 0 or less or band is less than 0
+    */
+    BandSymMatrix(const int size, const int band);
+    /**
+      * @brief   Copies source into a new BandSymMatrix
+      * @pre     None
+      * @post    Creates a new BandSymMatrix object that is identical to source
+      * @param   source - BandSymMatrix to copy
+      * @return  None
+    */
+    BandSymMatrix(const BandSymMatrix& source) = default;
+    /**
+      * @brief   Moves other's data into a new BandSymMatrix
+      * @pre     None
+      * @post    Moves other's data into C.O
+      * @param   other - BandSymMatrix to move
+      * @return  None
+    */
+    BandSymMatrix(BandSymMatrix&& other) = default;
+    /**
+      * @brief   Copies content from rhs into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   rhs - The BandSymMatrix to copy
+      * @return  *this as the C.O is being altered
+    */
+    BandSymMatrix& operator=(const BandSymMatrix& rhs) = default;
+    /**
+      * @brief   Move content from other into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   other - the BandSymMatrix to move
+      * @return  *this as the C.O is being altered
+    */
+    BandSymMatrix& operator=(BandSymMatrix&& other) = default;
+    /**
+      * @brief   Allows access to matrix elements.
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  Value at col, row or 0 outside of the band
+      * @throw   IF col or row are out of bounds
+    */
+    T operator()(const int col, const int row) const;
+    /**
+      * @brief   Allows access to matrix elements.
+      * @pre     col and row must be within bounds and the band
+      * @post    Allows the index to be changed, (row, col) changes with it
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  Reference to the stored value
+      * @throw   If col or row are out of bounds or outside of the band
+    */
+    T& operator()(const int col, const int row);
+    /**
+      * @brief   Gets the BandSymMatrix row size
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getRow() const { return m_size; }
+    /**
+      * @brief   Gets the BandSymMatrix col size
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getCol() const { return m_size; }
+    /**
+      * @brief   Gets the half bandwidth
+      * @pre     None
+      * @post    None
+      * @return  m_band
+    */
+    int getBand() const { return m_band; }
+    /**
+      * @brief   Gets the raw storage. Row i holds cols i - band through i at
+                  data()[i * (band + 1) + band - (i - col)], the slots left of
+                  col 0 in the first rows are padding
+      * @pre     None
+      * @post    None
+      * @return  Pointer to size * (band + 1) entries
+    */
+    const T* data() const { return ptr_to_data.data(); }
+    /**
+      * @brief   Gets the raw storage, see the const version for the layout
+      * @pre     None
+      * @post    The data may be changed through the pointer
+      * @return  Pointer to size * (band + 1) entries
+    */
+    T* data() { return ptr_to_data.data(); }
+};
+
+/**
+  * @brief   Multiply a BandSymMatrix by a vector
+  * @pre     Vector size must match BandSymMatrix cols
+  * @post    None
+  * @param   lhs - The BandSymMatrix to multiply
+  * @param   rhs - vector to multiply by
+  * @return  New vector
+  * @throw   If vector size doesn't match BandSymMatrix size
+*/
+template<typename T>
+vector<T> operator*(const BandSymMatrix<T>& lhs, const vector<T>& rhs);
+
+/**
+  * @brief   Displays the entries of the BandSymMatrix
+  * @pre     None
+  * @post    Displays the BandSymMatrix
+  * @param   out - ostream object used to display the BandSymMatrix
+  * @param   m - BandSymMatrix object to read data in from
+  * @return  The modified ostream object
+*/
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const BandSymMatrix<T>& m);
+
+#include "./band.hpp"
+
+#endif
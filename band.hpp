@@ -0,0 +1,119 @@
+/**
+  * @file   band.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Implements BandSymMatrix operators
+*/
+
+#include <exception>
+
+template<typename T>
+BandSymMatrix<T>::BandSymMatrix(const int size, const int band)
+{
+  if(size <= 0 || band < 0)
+  {
+    std::cerr << "Size less than one or band less than zero; Band" << std::endl;
+    throw std::out_of_range("Tried to set illegal bounds of BandSymMatrix");
+  }
+
+  m_size = size;
+  // Entries past the last row can never be reached
+  m_band = (band < size ? band : size - 1);
+  ptr_to_data = vector<T>(m_size * (m_band + 1));
+
+  for(int i = 0; i < m_size * (m_band + 1); i++)
+  {
+    ptr_to_data[i] = 0;
+  }
+}
+
+template<typename T>
+T BandSymMatrix<T>::operator()(const int col, const int row) const
+{
+  if(col < 0 || col >= m_size || row < 0 || row >= m_size)
+  {
+    std::cerr << "Out of bounds (); Band" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  const int r = (row > col ? row : col);
+  const int c = (row > col ? col : row);
+  if(r - c > m_band)
+  {
+    return 0;
+  }
+
+  return ptr_to_data[r * (m_band + 1) + m_band - (r - c)];
+}
+
+template<typename T>
+T& BandSymMatrix<T>::operator()(const int col, const int row)
+{
+  if(col < 0 || col >= m_size || row < 0 || row >= m_size)
+  {
+    std::cerr << "Out of bounds (); Band" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  const int r = (row > col ? row : col);
+  const int c = (row > col ? col : row);
+  if(r - c > m_band)
+  {
+    std::cerr << "Tried to set a value outside of the band" << std::endl;
+    throw std::out_of_range("Tried to set 0 to a value");
+  }
+
+  return ptr_to_data[r * (m_band + 1) + m_band - (r - c)];
+}
+
+template<typename T>
+vector<T> operator*(const BandSymMatrix<T>& lhs, const vector<T>& rhs)
+{
+  if(lhs.getCol() != rhs.getSize())
+  {
+    std::cerr << "Vector size and BandSymMatrix size do not match" << std::endl;
+    throw std::out_of_range("MISMATCHED VECTOR SIZE AND MATRIX SIZE");
+  }
+
+  const int n = lhs.getRow();
+  const int band = lhs.getBand();
+  const T* a = lhs.data();
+  const T* x = rhs.data();
+  vector<T> temp(n);
+  T* y = temp.data();
+
+  for(int i = 0; i < n; i++)
+  {
+    y[i] = 0;
+  }
+
+  // Each stored entry below the diagonal is used for its row and its mirror.
+  for(int i = 0; i < n; i++)
+  {
+    const int first = (i - band > 0 ? i - band : 0);
+    const T* rowI = a + i * (band + 1) + band - i;
+    T sum = 0;
+    for(int j = first; j < i; j++)
+    {
+      sum += rowI[j] * x[j];
+      y[j] += rowI[j] * x[i];
+    }
+    y[i] += sum + rowI[i] * x[i];
+  }
+
+  return temp;
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const BandSymMatrix<T>& m)
+{
+  for(int i = 0; i < m.getRow(); i++)
+  {
+    for(int j = 0; j < m.getCol(); j++)
+    {
+      out << m(j, i) << " ";
+    }
+    out << std::endl;
+  }
+
+  return out;
+}
@@ -0,0 +1,732 @@
+/**
+  * @file   bench.cpp
+  * @author Dylan Warren, Section A
+  * @brief  Microbenchmarks, run as ./bench mode [N] [reps]
+*/
+#include "partial.h"
+#include <iostream>
+#include <chrono>
+#include <iomanip>
+#include <string>
+#include <cmath>
+#include <random>
+#include <algorithm>
+#include "vector.h"
+#include "reordering.h"
+
+using namespace std::chrono;
+
+double edge(double x) { return x*(M_PI - x); }
+double forced(double x, double y) { return x*y*(x - y) + 1.0; }
+
+/**
+  * @brief   Runs body reps times
+  * @pre     reps must be at least 1
+  * @post    None
+  * @param   reps - How many times to run body
+  * @param   body - Work to time
+  * @return  The fastest run in milliseconds
+*/
+template<class Body>
+double fastest(const int reps, Body body)
+{
+  double best = 0;
+  for(int r = 0; r < reps; r++)
+  {
+    const auto start = steady_clock::now();
+    body();
+    const double ms = duration<double, std::milli>(steady_clock::now() - start).count();
+    best = (r == 0 || ms < best ? ms : best);
+  }
+  return best;
+}
+
+/**
+  * @brief   Largest difference between two vectors of the same size
+  * @pre     a and b must be the same size
+  * @post    None
+  * @param   a - First vector
+  * @param   b - Second vector
+  * @return  max |a[i] - b[i]|
+*/
+double maxDiff(const vector<double>& a, const vector<double>& b)
+{
+  double diff = 0;
+  for(int i = 0; i < a.getSize(); i++)
+  {
+    diff = (std::abs(a[i] - b[i]) > diff ? std::abs(a[i] - b[i]) : diff);
+  }
+  return diff;
+}
+
+/**
+  * @brief   Times makeRHS through function pointers, batch callbacks and
+              inlinable lambdas for the same closed form functions
+  * @pre     N must be greater than one
+  * @post    Prints one line of milliseconds
+  * @param   N - Partitions
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchRHS(const int N, const int reps)
+{
+  const PartialDiff<double> PDE(0, M_PI);
+  vector<double> byPointer, byBatch, byTemplate;
+
+  const BoundaryBatch edgeBatch = [](const double* x, double* out, const int count)
+  {
+    for(int i = 0; i < count; i++)
+    {
+      out[i] = x[i]*(M_PI - x[i]);
+    }
+  };
+  const ForcedBatch forcedBatch = [](const double* x, const double* y, double* out,
+                                     const int count)
+  {
+    for(int i = 0; i < count; i++)
+    {
+      out[i] = x[i]*y[i]*(x[i] - y[i]) + 1.0;
+    }
+  };
+  const auto edgeLambda = [](const double x) { return x*(M_PI - x); };
+  const auto forcedLambda = [](const double x, const double y) { return x*y*(x - y) + 1.0; };
+
+  const double pointerMs = fastest(reps, [&]
+  {
+    byPointer = PDE.makeRHS(edge, edge, edge, edge, forced, N);
+  });
+  const double batchMs = fastest(reps, [&]
+  {
+    byBatch = PDE.makeRHS(edgeBatch, edgeBatch, edgeBatch, edgeBatch, forcedBatch, N);
+  });
+  const double templateMs = fastest(reps, [&]
+  {
+    byTemplate = PDE.makeRHS(edgeLambda, edgeLambda, edgeLambda, edgeLambda, forcedLambda, N);
+  });
+
+  std::cout << std::setw(6) << N << std::setw(12) << pointerMs << std::setw(12) << batchMs
+            << std::setw(12) << templateMs << std::setw(12) << pointerMs / templateMs
+            << "   diff " << std::scientific << std::setprecision(1)
+            << std::max(maxDiff(byPointer, byTemplate), maxDiff(byBatch, byTemplate))
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+/**
+  * @brief   The column streaming product DenseMatrix used before gemm, kept
+              as the baseline
+  * @pre     a is m by k and b is k by n, both column major
+  * @post    c is overwritten
+  * @param   m - Rows of a and c
+  * @param   n - Columns of b and c
+  * @param   k - Columns of a, rows of b
+  * @param   a - Left factor
+  * @param   b - Right factor
+  * @param   c - Product
+  * @return  None
+*/
+void streamingMultiply(const int m, const int n, const int k,
+                       const double* a, const double* b, double* c)
+{
+  for(int j = 0; j < n; j++)
+  {
+    double* cj = c + j * m;
+    for(int i = 0; i < m; i++)
+    {
+      cj[i] = 0;
+    }
+    for(int p = 0; p < k; p++)
+    {
+      const double bpj = b[j * k + p];
+      const double* ap = a + p * m;
+      for(int i = 0; i < m; i++)
+      {
+        cj[i] += bpj * ap[i];
+      }
+    }
+  }
+}
+
+/**
+  * @brief   GFLOP/s of the streaming product and of gemm for one N by N
+              product, the streaming one is skipped past N = 1024
+  * @pre     N must be positive
+  * @post    Prints one line of GFLOP/s
+  * @param   N - Rows and columns of every matrix
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchGemm(const int N, const int reps)
+{
+  DenseMatrix<double> A(N, N), B(N, N), C(N, N), ref(N, N);
+  for(int j = 0; j < N; j++)
+  {
+    for(int i = 0; i < N; i++)
+    {
+      A(j, i) = std::sin(0.37 * i + 1.3 * j);
+      B(j, i) = std::cos(0.71 * i - 0.29 * j);
+    }
+  }
+
+  const double flops = 2.0 * N * N * static_cast<double>(N);
+  const int runs = (N >= 2048 ? 1 : reps);
+  const bool streaming = (N <= 1024);
+  double streamingMs = 0;
+  if(streaming)
+  {
+    streamingMs = fastest(runs, [&]
+    {
+      streamingMultiply(N, N, N, A.data(), B.data(), ref.data());
+    });
+  }
+  const double gemmMs = fastest(runs, [&]
+  {
+    gemm(N, N, N, 1.0, A.data(), 1, N, B.data(), 1, N, 0.0, C.data(), 1, N);
+  });
+
+  std::cout << std::setw(6) << N;
+  if(streaming)
+  {
+    double diff = 0;
+    for(int i = 0; i < N * N; i++)
+    {
+      diff = std::max(diff, std::abs(C.data()[i] - ref.data()[i]));
+    }
+    std::cout << std::setw(12) << flops / streamingMs / 1e6 << std::setw(12)
+              << flops / gemmMs / 1e6 << std::setw(12) << streamingMs / gemmMs
+              << "   diff " << std::scientific << std::setprecision(1) << diff
+              << std::fixed << std::setprecision(3) << std::endl;
+  }
+  else
+  {
+    std::cout << std::setw(12) << "-" << std::setw(12) << flops / gemmMs / 1e6
+              << std::setw(12) << "-" << std::endl;
+  }
+}
+
+/**
+  * @brief   Times filling a SymMatrix, factoring it with CholeskyFactor and
+              one solve, plus GaussianSolver's one shot SymMatrix solve
+  * @pre     N must be positive
+  * @post    Prints one line of milliseconds
+  * @param   N - Rows and columns of the matrix
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchCholesky(const int N, const int reps)
+{
+  SymMatrix<double> A(N, N);
+  vector<double> B(N);
+  const int runs = (N >= 2048 ? 1 : reps);
+
+  const double fillMs = fastest(runs, [&]
+  {
+    for(int col = 0; col < N; col++)
+    {
+      for(int row = col; row < N; row++)
+      {
+        A(col, row) = (row == col ? N : 1.0 / (1 + row - col));
+      }
+    }
+  });
+  for(int i = 0; i < N; i++)
+  {
+    B[i] = std::sin(0.1 * i);
+  }
+
+  const double factorMs = fastest(runs, [&]
+  {
+    CholeskyFactor<double> factor(A);
+  });
+  const CholeskyFactor<double> factor(A);
+  vector<double> x;
+  const double solveMs = fastest(runs, [&]
+  {
+    x = factor.solve(B);
+  });
+  const GaussianSolver<double> gauss;
+  const double oneShotMs = fastest(runs, [&]
+  {
+    x = gauss(A, B);
+  });
+
+  double residual = 0;
+  for(int row = 0; row < N; row++)
+  {
+    double sum = -B[row];
+    for(int col = 0; col < N; col++)
+    {
+      sum += A(col, row) * x[col];
+    }
+    residual = std::max(residual, std::abs(sum));
+  }
+
+  std::cout << std::setw(6) << N << std::setw(12) << fillMs << std::setw(12) << factorMs
+            << std::setw(12) << solveMs << std::setw(12) << oneShotMs
+            << std::setw(12) << N * static_cast<double>(N) * N / 3 / factorMs / 1e6
+            << "   residual " << std::scientific << std::setprecision(1) << residual
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+/**
+  * @brief   Factors a shifted, indefinite SymMatrix with LDLTFactorization
+              and its dense copy with LUFactorization, next to
+              CholeskyFactor on the unshifted positive definite matrix
+  * @pre     N must be positive
+  * @post    Prints one line of milliseconds and the inertia
+  * @param   N - Rows and columns of the matrix
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchLDLT(const int N, const int reps)
+{
+  // The decaying off diagonal part alone has eigenvalues from about 0.6 to
+  // 2 ln N, so -0.5 on the diagonal gives a Helmholtz like operator of both
+  // signs while N on it keeps A positive definite
+  SymMatrix<double> A(N, N);
+  SymMatrix<double> shifted(N, N);
+  DenseMatrix<double> dense(N, N);
+  for(int col = 0; col < N; col++)
+  {
+    for(int row = col; row < N; row++)
+    {
+      A(col, row) = (row == col ? N : 1.0 / (1 + row - col));
+      shifted(col, row) = (row == col ? -0.5 : A(col, row));
+      dense(col, row) = shifted(col, row);
+      dense(row, col) = shifted(col, row);
+    }
+  }
+  vector<double> B(N);
+  for(int i = 0; i < N; i++)
+  {
+    B[i] = std::sin(0.1 * i);
+  }
+  const int runs = (N >= 2048 ? 1 : reps);
+
+  const double cholMs = fastest(runs, [&]
+  {
+    CholeskyFactor<double> factor(A);
+  });
+  const double ldltMs = fastest(runs, [&]
+  {
+    LDLTFactorization<double> factor(shifted);
+  });
+  const double luMs = fastest(runs, [&]
+  {
+    LUFactorization<double> factor(dense);
+  });
+
+  const LDLTFactorization<double> factor(shifted);
+  const vector<double> x = factor.solve(B);
+  const vector<double> Ax = dense * x;
+  double residual = 0;
+  for(int i = 0; i < N; i++)
+  {
+    residual = std::max(residual, std::abs(Ax[i] - B[i]));
+  }
+  const Inertia inertia = factor.getInertia();
+
+  std::cout << std::setw(6) << N << std::setw(12) << cholMs << std::setw(12) << ldltMs
+            << std::setw(12) << luMs << std::setw(8) << inertia.positive
+            << std::setw(8) << inertia.negative << std::setw(8) << inertia.zero
+            << "   residual " << std::scientific << std::setprecision(1) << residual
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+/**
+  * @brief   Times y = A x for a SymMatrix through the element accessor, the
+              old operator*, and through spmv on one thread and on the pool
+  * @pre     N must be positive
+  * @post    Prints one line of milliseconds
+  * @param   N - Rows and columns of the matrix
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchSymv(const int N, const int reps)
+{
+  SymMatrix<double> A(N, N);
+  vector<double> x(N);
+  for(int col = 0; col < N; col++)
+  {
+    for(int row = col; row < N; row++)
+    {
+      A(col, row) = 1.0 / (1 + row - col);
+    }
+    x[col] = std::sin(0.1 * col);
+  }
+
+  vector<double> y(N);
+  const double accessorMs = fastest(reps, [&]
+  {
+    for(int i = 0; i < N; i++)
+    {
+      double sum = 0;
+      for(int j = 0; j < N; j++)
+      {
+        sum += A(j, i) * x[j];
+      }
+      y[i] = sum;
+    }
+  });
+  const vector<double> reference = y;
+
+  ThreadPool serial(1);
+  const double serialMs = fastest(reps * 10, [&]
+  {
+    spmv(N, A.column(0), x.data(), y.data(), serial);
+  });
+  const double poolMs = fastest(reps * 10, [&]
+  {
+    y = A * x;
+  });
+
+  std::cout << std::setw(6) << N << std::setw(12) << accessorMs << std::setw(12) << serialMs
+            << std::setw(12) << poolMs
+            << std::setw(12) << N * static_cast<double>(N) * 2 / poolMs / 1e6
+            << std::setw(12) << accessorMs / poolMs
+            << "   maxdiff " << std::scientific << std::setprecision(1) << maxDiff(y, reference)
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+/**
+  * @brief   Strong scaling of CholeskyFactor, the same matrix factored on
+              pools of 1, 2, 4 ... threads up to one per core
+  * @pre     N must be positive
+  * @post    Prints one line per thread count
+  * @param   N - Rows and columns of the matrix
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchScaling(const int N, const int reps)
+{
+  SymMatrix<double> A(N, N);
+  for(int col = 0; col < N; col++)
+  {
+    for(int row = col; row < N; row++)
+    {
+      A(col, row) = (row == col ? N : 1.0 / (1 + row - col));
+    }
+  }
+  const int runs = (N >= 2048 ? 1 : reps);
+  const int cores = ThreadPool::global().getThreads();
+
+  // 1, 2, 4 ... and then every core, so the last line is always the full pool
+  double serialMs = 0;
+  int threads = 1;
+  while(true)
+  {
+    ThreadPool pool(threads);
+    const double ms = fastest(runs, [&]
+    {
+      CholeskyFactor<double> factor(A, pool);
+    });
+    serialMs = (threads == 1 ? ms : serialMs);
+
+    std::cout << std::setw(6) << N << std::setw(9) << threads << std::setw(12) << ms
+              << std::setw(12) << N * static_cast<double>(N) * N / 3 / ms / 1e6
+              << std::setw(12) << serialMs / ms
+              << std::setw(12) << serialMs / ms / threads << std::endl;
+
+    if(threads == cores)
+    {
+      break;
+    }
+    threads = (threads * 2 < cores ? threads * 2 : cores);
+  }
+}
+
+/**
+  * @brief   Solves the N partition Poisson system with the band Cholesky and
+              with SparseCholesky in minimum degree and nested dissection
+              order, reporting the entries of L and the time of each, and
+              of the minimum degree ordering on its own
+  * @pre     N must be greater than one
+  * @post    Prints one line
+  * @param   N - Partitions of the mesh
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchSparse(const int N, const int reps)
+{
+  const PartialDiff<double> PDE(0, M_PI);
+  const SparseMatrix<double> A = PDE.makeSparse(N);
+  const BandSymMatrix<double> band = PDE.makeBand(N);
+  const int n = A.getRow();
+  vector<double> B(n);
+  for(int i = 0; i < n; i++)
+  {
+    B[i] = std::sin(0.1 * i);
+  }
+  const int runs = (N >= 200 ? 1 : reps);
+
+  const GaussianSolver<double> gauss;
+  vector<double> x;
+  const double bandMs = fastest(runs, [&]
+  {
+    x = gauss(band, B);
+  });
+  const long long bandEntries = static_cast<long long>(n) * N;
+
+  vector<int> amdPerm;
+  const double orderMs = fastest(runs, [&]
+  {
+    amdPerm = minimumDegree(A);
+  });
+
+  long long amdEntries = 0;
+  const double amdMs = fastest(runs, [&]
+  {
+    const SparseCholesky<double> chol(A, MINIMUM_DEGREE);
+    x = chol.solve(B);
+    amdEntries = chol.getFactorNonZeros();
+  });
+
+  SparseCholesky<double> nested(A, nestedDissection(N - 1, N - 1));
+  const double ndMs = fastest(runs, [&]
+  {
+    const SparseCholesky<double> chol(A, nestedDissection(N - 1, N - 1));
+    x = chol.solve(B);
+  });
+  const double refactorMs = fastest(runs, [&]
+  {
+    nested.factor(A);
+    x = nested.solve(B);
+  });
+
+  const vector<double> Ax = A * x;
+  double residual = 0;
+  for(int i = 0; i < n; i++)
+  {
+    residual = std::max(residual, std::abs(Ax[i] - B[i]));
+  }
+
+  std::cout << std::setw(6) << N << std::setw(12) << bandEntries << std::setw(12) << bandMs
+            << std::setw(12) << amdEntries << std::setw(12) << amdMs << std::setw(12) << orderMs
+            << std::setw(12) << nested.getFactorNonZeros() << std::setw(12) << ndMs
+            << std::setw(12) << refactorMs
+            << "   residual " << std::scientific << std::setprecision(1) << residual
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+/**
+  * @brief   Scrambles the N partition Poisson system with a random
+              permutation, then solves it densely and with RCM plus the band
+              and the skyline Cholesky, reporting bandwidth and profile
+              before and after
+  * @pre     N must be greater than one
+  * @post    Prints one line
+  * @param   N - Partitions of the mesh
+  * @param   reps - Runs of each, the fastest is kept
+  * @return  None
+*/
+void benchReorder(const int N, const int reps)
+{
+  const PartialDiff<double> PDE(0, M_PI);
+  const SparseMatrix<double> grid = PDE.makeSparse(N);
+  const int n = grid.getRow();
+
+  std::vector<int> shuffle(n);
+  for(int i = 0; i < n; i++)
+  {
+    shuffle[i] = i;
+  }
+  std::shuffle(shuffle.begin(), shuffle.end(), std::mt19937(5201));
+  SymMatrix<double> A(n, n);
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = grid.rowStart()[r]; k < grid.rowStart()[r + 1]; k++)
+    {
+      A(shuffle[grid.colIndex()[k]], shuffle[r]) = grid.values()[k];
+    }
+  }
+  vector<double> B(n);
+  for(int i = 0; i < n; i++)
+  {
+    B[i] = std::sin(0.1 * i);
+  }
+  const int runs = (N >= 40 ? 1 : reps);
+
+  const GaussianSolver<double> gauss;
+  vector<double> dense;
+  const double denseMs = fastest(runs, [&]
+  {
+    dense = gauss(A, B);
+  });
+
+  vector<double> x;
+  const BandReordering<double> rcm(A);
+  const double rcmMs = fastest(runs, [&]
+  {
+    const BandReordering<double> order(A);
+    x = order.restore(gauss(order.toBand(A), order.apply(B)));
+  });
+  const double skylineMs = fastest(runs, [&]
+  {
+    const BandReordering<double> order(A);
+    x = order.restore(gauss(order.toSkyline(A), order.apply(B)));
+  });
+
+  const vector<double> Ax = A * x;
+  double residual = 0;
+  for(int i = 0; i < n; i++)
+  {
+    residual = std::max(residual, std::abs(Ax[i] - B[i]));
+  }
+
+  std::cout << std::setw(6) << N << std::setw(10) << rcm.getBandwidthBefore()
+            << std::setw(10) << rcm.getBandwidthAfter()
+            << std::setw(12) << rcm.getProfileBefore() << std::setw(12) << rcm.getProfileAfter()
+            << std::setw(12) << denseMs << std::setw(12) << rcmMs
+            << std::setw(12) << skylineMs << std::setw(12) << denseMs / rcmMs
+            << "   residual " << std::scientific << std::setprecision(1) << residual
+            << std::fixed << std::setprecision(3) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string mode = (argc > 1 ? argv[1] : "");
+  const int reps = (argc > 3 ? std::stoi(argv[3]) : 5);
+  std::cout << std::fixed << std::setprecision(3);
+
+  if(mode == "rhs")
+  {
+    std::cout << "     N  pointer ms    batch ms template ms     speedup" << std::endl;
+    if(argc > 2)
+    {
+      benchRHS(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 250; N <= 4000; N *= 2)
+      {
+        benchRHS(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "gemm")
+  {
+    std::cout << "     N  stream GF/s   gemm GF/s     speedup   threads "
+              << ThreadPool::global().getThreads() << std::endl;
+    if(argc > 2)
+    {
+      benchGemm(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 64; N <= 4096; N *= 2)
+      {
+        benchGemm(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "chol")
+  {
+    std::cout << "     N     fill ms   factor ms    solve ms gaussian ms factor GF/s" << std::endl;
+    if(argc > 2)
+    {
+      benchCholesky(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 256; N <= 2048; N *= 2)
+      {
+        benchCholesky(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "ldlt")
+  {
+    std::cout << "     N     chol ms     LDLT ms       LU ms       +       -       0" << std::endl;
+    if(argc > 2)
+    {
+      benchLDLT(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 256; N <= 2048; N *= 2)
+      {
+        benchLDLT(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "symv")
+  {
+    std::cout << "     N accessor ms   serial ms     pool ms   pool GF/s     speedup   threads "
+              << ThreadPool::global().getThreads() << std::endl;
+    if(argc > 2)
+    {
+      benchSymv(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 500; N <= 4000; N *= 2)
+      {
+        benchSymv(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "scale")
+  {
+    std::cout << "     N  threads   factor ms        GF/s     speedup  efficiency" << std::endl;
+    if(argc > 2)
+    {
+      benchScaling(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 1000; N <= 4000; N *= 2)
+      {
+        benchScaling(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "sparse")
+  {
+    std::cout << "     N   band |L|     band ms    AMD |L|      AMD ms    order ms     ND |L|"
+              << "       ND ms refactor ms" << std::endl;
+    if(argc > 2)
+    {
+      benchSparse(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 50; N <= 400; N *= 2)
+      {
+        benchSparse(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  if(mode == "rcm")
+  {
+    std::cout << "     N   band in  band out  profile in profile out    dense ms     band ms"
+              << "  skyline ms     speedup" << std::endl;
+    if(argc > 2)
+    {
+      benchReorder(std::stoi(argv[2]), reps);
+    }
+    else
+    {
+      for(int N = 20; N <= 80; N *= 2)
+      {
+        benchReorder(N, reps);
+      }
+    }
+    return 0;
+  }
+
+  std::cerr << "usage: ./bench rhs|gemm|chol|ldlt|symv|scale|sparse|rcm [N] [reps]" << std::endl;
+  return 1;
+}
@@ -0,0 +1,210 @@
+/**
+  * @file   blas.h
+  * @author Dylan Warren, Section A
+  * @brief  Dense kernels in the style of BLAS, on raw blocks with strides.
+*/
+/**
+  * A matrix handed to these kernels is a pointer and two strides, entry
+  * (row i, col j) of A is A[i * rs + j * cs]. A ColMajor block with leading
+  * dimension ld has rs = 1 and cs = ld, a RowMajor one rs = ld and cs = 1,
+  * and swapping rs and cs passes the transpose without copying it.
+*/
+#ifndef BLAS_H
+#define BLAS_H
+
+#include "./aligned.h"
+#include "./threadpool.h"
+
+/** Which triangle of a packed matrix is stored */
+enum TriangleType
+{
+  LOWER_TRIANGLE = 0,
+  UPPER_TRIANGLE = 1
+};
+
+/** Whether a kernel uses A or A^T */
+enum TransposeType
+{
+  NO_TRANSPOSE = 0,
+  TRANSPOSE = 1
+};
+
+/** Register (MR by NR) and cache (MC, KC, NC) block sizes of gemm */
+struct GemmBlocking
+{
+  static const int MR = 8;
+  static const int NR = 4;
+  static const int MC = 128;
+  static const int KC = 256;
+  static const int NC = 4096;
+  /** Order of the diagonal blocks of tpsm and tpmm */
+  static const int TB = 64;
+  /** Columns trsmRight solves one by one before a gemm catches up */
+  static const int TS = 32;
+  /** Order below which spmv stays on the calling thread */
+  static const int SV = 512;
+};
+
+/**
+  * @brief   C = alpha A B + beta C with A m by k, B k by n and C m by n.
+              Panels of B (KC by NC) and A (MC by KC) are packed into MR and
+              NR wide slivers, and an MR by NR micro-kernel keeps its block of
+              C in registers. Blocks of C are split across the pool.
+  * @pre     C must not overlap A or B
+  * @post    C is overwritten
+  * @param   m - Rows of A and C
+  * @param   n - Columns of B and C
+  * @param   k - Columns of A, rows of B
+  * @param   alpha - Scales A B
+  * @param   A - Entry (0, 0) of A
+  * @param   rsA - Distance between rows of A
+  * @param   csA - Distance between columns of A
+  * @param   B - Entry (0, 0) of B
+  * @param   rsB - Distance between rows of B
+  * @param   csB - Distance between columns of B
+  * @param   beta - Scales C first, 0 ignores what C held
+  * @param   C - Entry (0, 0) of C
+  * @param   rsC - Distance between rows of C
+  * @param   csC - Distance between columns of C
+  * @param   pool - Threads to use
+  * @return  None
+*/
+template<class T>
+void gemm(const int m, const int n, const int k, const T alpha,
+          const T* A, const int rsA, const int csA,
+          const T* B, const int rsB, const int csB,
+          const T beta, T* C, const int rsC, const int csC,
+          ThreadPool& pool = ThreadPool::global());
+
+/**
+  * A packed triangle stores its columns one after the other. A lower one
+  * holds rows j .. n - 1 of column j starting at j n - j (j - 1) / 2, an
+  * upper one rows 0 .. j starting at j (j + 1) / 2, the layouts of
+  * LowerTriangle and UpperTriangle. Both kernels below only walk columns,
+  * as an axpy or a dot product, so every inner loop is unit stride.
+*/
+/**
+  * @brief   x = op(A) x for a packed n by n triangle
+  * @pre     ap holds n (n + 1) / 2 values in the layout of uplo
+  * @post    x is overwritten
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   trans - NO_TRANSPOSE for A, TRANSPOSE for A^T
+  * @param   n - Order of A
+  * @param   ap - Packed A
+  * @param   x - n values
+  * @return  None
+*/
+template<class T>
+void tpmv(const int uplo, const int trans, const int n, const T* ap, T* x);
+
+/**
+  * @brief   Solves op(A) x = b for a packed n by n triangle
+  * @pre     ap holds n (n + 1) / 2 values in the layout of uplo, no zeros on
+              the diagonal
+  * @post    x is overwritten with the solution
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   trans - NO_TRANSPOSE for A, TRANSPOSE for A^T
+  * @param   n - Order of A
+  * @param   ap - Packed A
+  * @param   x - b on entry
+  * @return  None
+*/
+template<class T>
+void tpsv(const int uplo, const int trans, const int n, const T* ap, T* x);
+
+/**
+  * @brief   y = A x for a symmetric A with its lower triangle packed by
+              column, the layout of SymMatrix. Columns are taken two at a
+              time and every stored entry is read once, for a dot product
+              into y(j) and an axpy into y(i). Above SV the columns are split
+              across the pool in pieces of equal area, each adding into its
+              own copy of y, and the copies are summed at the end.
+  * @pre     ap holds n (n + 1) / 2 values, x and y do not overlap
+  * @post    y is overwritten
+  * @param   n - Order of A
+  * @param   ap - Packed lower triangle of A
+  * @param   x - n values
+  * @param   y - n values
+  * @param   pool - Threads to use
+  * @return  None
+*/
+template<class T>
+void spmv(const int n, const T* ap, const T* x, T* y, ThreadPool& pool = ThreadPool::global());
+
+/**
+  * @brief   Solves op(A) X = B for a packed n by n triangle and k right hand
+              sides. Blocks of TB rows are solved with tpsv, split across the
+              pool by column, and the rest of B is updated with gemm.
+  * @pre     ap holds n (n + 1) / 2 values in the layout of uplo, no zeros on
+              the diagonal
+  * @post    B is overwritten with X
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   trans - NO_TRANSPOSE for A, TRANSPOSE for A^T
+  * @param   n - Order of A
+  * @param   ap - Packed A
+  * @param   k - Right hand sides
+  * @param   B - Column major n by k block
+  * @param   ldb - Distance between columns of B
+  * @param   pool - Threads to use
+  * @return  None
+*/
+template<class T>
+void tpsm(const int uplo, const int trans, const int n, const T* ap, const int k,
+          T* B, const int ldb, ThreadPool& pool = ThreadPool::global());
+
+/**
+  * @brief   B = op(A) B for a packed n by n triangle and an n by k block.
+              Blocks of TB rows are multiplied with tpmv, split across the
+              pool by column, and the rest of each product comes from gemm.
+  * @pre     ap holds n (n + 1) / 2 values in the layout of uplo
+  * @post    B is overwritten
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   trans - NO_TRANSPOSE for A, TRANSPOSE for A^T
+  * @param   n - Order of A
+  * @param   ap - Packed A
+  * @param   k - Columns of B
+  * @param   B - Column major n by k block
+  * @param   ldb - Distance between columns of B
+  * @param   pool - Threads to use
+  * @return  None
+*/
+template<class T>
+void tpmm(const int uplo, const int trans, const int n, const T* ap, const int k,
+          T* B, const int ldb, ThreadPool& pool = ThreadPool::global());
+
+/**
+  * @brief   Cholesky factors a dense column major block in place, A = L L^T,
+              left-looking one column at a time and skipping zero multipliers
+  * @pre     The lower half of a holds a symmetric n by n matrix
+  * @post    The lower half of a holds L, the upper half is untouched
+  * @param   n - Order of A
+  * @param   a - Top left of A
+  * @param   lda - Distance between columns of a
+  * @return  0, or j + 1 when column j has no positive pivot and a is left
+              part way through
+*/
+template<class T>
+int potrf(const int n, T* a, const int lda);
+
+/**
+  * @brief   Solves X L^T = B in place for a dense lower triangular L. Strips
+              of TS columns are solved one by one, each brought up to date
+              by one gemm with the strips before it.
+  * @pre     l has no zeros on its diagonal
+  * @post    b holds X
+  * @param   m - Rows of B
+  * @param   n - Order of L, cols of B
+  * @param   l - Top left of L, only its lower half is read
+  * @param   ldl - Distance between columns of l
+  * @param   b - Top left of B
+  * @param   ldb - Distance between columns of b
+  * @param   pool - Threads for the gemm
+  * @return  None
+*/
+template<class T>
+void trsmRight(const int m, const int n, const T* l, const int ldl, T* b, const int ldb,
+               ThreadPool& pool = ThreadPool::global());
+
+#include "./blas.hpp"
+
+#endif
@@ -0,0 +1,930 @@
+/**
+  * @file   blas.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the dense kernels and their packing and micro-kernels
+*/
+#include <type_traits>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BLAS_HAS_AVX2_KERNEL 1
+#endif
+
+/**
+  * @brief   acc = a b for an MR sliver of A and an NR sliver of B
+  * @pre     a holds kc groups of MR, b kc groups of NR
+  * @post    acc is overwritten, entry (i, j) at j * MR + i
+  * @param   kc - Depth of the slivers
+  * @param   a - Packed A sliver
+  * @param   b - Packed B sliver
+  * @param   acc - MR by NR result
+  * @return  None
+*/
+template<class T>
+inline void gemmKernel(const int kc, const T* a, const T* b, T* acc)
+{
+  const int MR = GemmBlocking::MR;
+  const int NR = GemmBlocking::NR;
+  // Fixed trip counts, the compiler keeps c in registers and vectorises i
+  T c[MR * NR] = {};
+  for(int p = 0; p < kc; p++)
+  {
+    const T* ap = a + p * MR;
+    const T* bp = b + p * NR;
+    for(int j = 0; j < NR; j++)
+    {
+      const T bj = bp[j];
+      for(int i = 0; i < MR; i++)
+      {
+        c[j * MR + i] += ap[i] * bj;
+      }
+    }
+  }
+  for(int i = 0; i < MR * NR; i++)
+  {
+    acc[i] = c[i];
+  }
+}
+
+#ifdef BLAS_HAS_AVX2_KERNEL
+/**
+  * @brief   gemmKernel built for AVX2 and FMA, picked at run time
+  * @pre     The CPU supports AVX2 and FMA
+  * @post    acc is overwritten, entry (i, j) at j * MR + i
+  * @param   kc - Depth of the slivers
+  * @param   a - Packed A sliver
+  * @param   b - Packed B sliver
+  * @param   acc - MR by NR result
+  * @return  None
+*/
+__attribute__((target("avx2,fma")))
+inline void gemmKernelAvx2(const int kc, const double* a, const double* b, double* acc)
+{
+  const int MR = GemmBlocking::MR;
+  const int NR = GemmBlocking::NR;
+  double c[MR * NR] = {};
+  for(int p = 0; p < kc; p++)
+  {
+    const double* ap = a + p * MR;
+    const double* bp = b + p * NR;
+    for(int j = 0; j < NR; j++)
+    {
+      const double bj = bp[j];
+      for(int i = 0; i < MR; i++)
+      {
+        c[j * MR + i] += ap[i] * bj;
+      }
+    }
+  }
+  for(int i = 0; i < MR * NR; i++)
+  {
+    acc[i] = c[i];
+  }
+}
+
+/**
+  * @brief   Checks once if gemmKernelAvx2 can run here
+  * @pre     None
+  * @post    None
+  * @return  True if the CPU has AVX2 and FMA
+*/
+inline bool hasAvx2Kernel()
+{
+  static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  return supported;
+}
+#endif
+
+/**
+  * @brief   Packs an mc by kc block of A into MR row slivers, padding the
+              last sliver with zeros
+  * @pre     out holds ceil(mc / MR) MR kc values
+  * @post    Sliver s, depth p, row i is at (s kc + p) MR + i
+  * @param   mc - Rows to pack
+  * @param   kc - Columns to pack
+  * @param   A - Entry (0, 0) of the block
+  * @param   rs - Distance between rows
+  * @param   cs - Distance between columns
+  * @param   out - Packed block
+  * @return  None
+*/
+template<class T>
+void gemmPackA(const int mc, const int kc, const T* A, const int rs, const int cs, T* out)
+{
+  const int MR = GemmBlocking::MR;
+  for(int s = 0; s * MR < mc; s++)
+  {
+    const int rows = (mc - s * MR < MR ? mc - s * MR : MR);
+    T* sliver = out + s * MR * kc;
+    const T* a = A + s * MR * rs;
+    for(int p = 0; p < kc; p++)
+    {
+      const T* ap = a + p * cs;
+      for(int i = 0; i < rows; i++)
+      {
+        sliver[p * MR + i] = ap[i * rs];
+      }
+      for(int i = rows; i < MR; i++)
+      {
+        sliver[p * MR + i] = 0;
+      }
+    }
+  }
+}
+
+/**
+  * @brief   Packs a kc by nc block of B into NR column slivers, padding the
+              last sliver with zeros
+  * @pre     out holds ceil(nc / NR) NR kc values
+  * @post    Sliver t, depth p, column j is at (t kc + p) NR + j
+  * @param   kc - Rows to pack
+  * @param   nc - Columns to pack
+  * @param   B - Entry (0, 0) of the block
+  * @param   rs - Distance between rows
+  * @param   cs - Distance between columns
+  * @param   out - Packed block
+  * @return  None
+*/
+template<class T>
+void gemmPackB(const int kc, const int nc, const T* B, const int rs, const int cs, T* out)
+{
+  const int NR = GemmBlocking::NR;
+  for(int t = 0; t * NR < nc; t++)
+  {
+    const int cols = (nc - t * NR < NR ? nc - t * NR : NR);
+    T* sliver = out + t * NR * kc;
+    const T* b = B + t * NR * cs;
+    for(int p = 0; p < kc; p++)
+    {
+      const T* bp = b + p * rs;
+      for(int j = 0; j < cols; j++)
+      {
+        sliver[p * NR + j] = bp[j * cs];
+      }
+      for(int j = cols; j < NR; j++)
+      {
+        sliver[p * NR + j] = 0;
+      }
+    }
+  }
+}
+
+/**
+  * @brief   C += alpha a b for packed blocks, one micro-kernel per MR by NR
+              tile of C
+  * @pre     a and b come from gemmPackA and gemmPackB
+  * @post    C is updated
+  * @param   mc - Rows of the block
+  * @param   nc - Columns of the block
+  * @param   kc - Depth of the block
+  * @param   alpha - Scales a b
+  * @param   a - Packed A block
+  * @param   b - Packed B block
+  * @param   C - Entry (0, 0) of the C block
+  * @param   rsC - Distance between rows of C
+  * @param   csC - Distance between columns of C
+  * @return  None
+*/
+template<class T>
+void gemmMacroKernel(const int mc, const int nc, const int kc, const T alpha,
+                     const T* a, const T* b, T* C, const int rsC, const int csC)
+{
+  const int MR = GemmBlocking::MR;
+  const int NR = GemmBlocking::NR;
+  T acc[MR * NR];
+
+  for(int jr = 0; jr < nc; jr += NR)
+  {
+    const int cols = (nc - jr < NR ? nc - jr : NR);
+    const T* bSliver = b + (jr / NR) * NR * kc;
+    for(int ir = 0; ir < mc; ir += MR)
+    {
+      const int rows = (mc - ir < MR ? mc - ir : MR);
+      const T* aSliver = a + (ir / MR) * MR * kc;
+
+#ifdef BLAS_HAS_AVX2_KERNEL
+      if constexpr(std::is_same<T, double>::value)
+      {
+        if(hasAvx2Kernel())
+        {
+          gemmKernelAvx2(kc, aSliver, bSliver, acc);
+        }
+        else
+        {
+          gemmKernel(kc, aSliver, bSliver, acc);
+        }
+      }
+      else
+      {
+        gemmKernel(kc, aSliver, bSliver, acc);
+      }
+#else
+      gemmKernel(kc, aSliver, bSliver, acc);
+#endif
+
+      T* c = C + ir * rsC + jr * csC;
+      for(int j = 0; j < cols; j++)
+      {
+        for(int i = 0; i < rows; i++)
+        {
+          c[i * rsC + j * csC] += alpha * acc[j * MR + i];
+        }
+      }
+    }
+  }
+}
+
+template<typename T>
+void gemm(const int m, const int n, const int k, const T alpha,
+          const T* A, const int rsA, const int csA,
+          const T* B, const int rsB, const int csB,
+          const T beta, T* C, const int rsC, const int csC,
+          ThreadPool& pool)
+{
+  if(m <= 0 || n <= 0)
+  {
+    return;
+  }
+
+  if(beta != 1)
+  {
+    for(int j = 0; j < n; j++)
+    {
+      for(int i = 0; i < m; i++)
+      {
+        T& c = C[i * rsC + j * csC];
+        c = (beta == 0 ? static_cast<T>(0) : beta * c);
+      }
+    }
+  }
+  if(k <= 0 || alpha == 0)
+  {
+    return;
+  }
+
+  const int MR = GemmBlocking::MR;
+  const int NR = GemmBlocking::NR;
+  const int MC = GemmBlocking::MC;
+  const int KC = GemmBlocking::KC;
+  const int NC = GemmBlocking::NC;
+
+  // Packing costs more than it saves on tiny products
+  if(static_cast<long long>(m) * n * k <= 32 * 32 * 32)
+  {
+    for(int j = 0; j < n; j++)
+    {
+      for(int p = 0; p < k; p++)
+      {
+        const T bpj = alpha * B[p * rsB + j * csB];
+        const T* ap = A + p * csA;
+        T* cj = C + j * csC;
+        for(int i = 0; i < m; i++)
+        {
+          cj[i * rsC] += ap[i * rsA] * bpj;
+        }
+      }
+    }
+    return;
+  }
+
+  // Tiles of C are MC rows by a share of the NC panel, enough for every thread
+  const int ncMax = (n < NC ? n : NC);
+  const int mBlocks = (m + MC - 1) / MC;
+  int nSplit = (pool.getThreads() + mBlocks - 1) / mBlocks;
+  const int maxSplit = (ncMax + NR - 1) / NR;
+  nSplit = (nSplit < maxSplit ? nSplit : maxSplit);
+  const int tiles = mBlocks * nSplit;
+  const int parts = (tiles < pool.getThreads() ? tiles : pool.getThreads());
+
+  AlignedBuffer<T> packedB(((ncMax + NR - 1) / NR) * NR * KC);
+  AlignedBuffer<T> packedA(parts * ((MC + MR - 1) / MR) * MR * KC);
+
+  for(int jc = 0; jc < n; jc += NC)
+  {
+    const int nc = (n - jc < NC ? n - jc : NC);
+    // Sliver aligned share of the panel for each tile column
+    const int share = (((nc + nSplit - 1) / nSplit + NR - 1) / NR) * NR;
+
+    for(int pc = 0; pc < k; pc += KC)
+    {
+      const int kc = (k - pc < KC ? k - pc : KC);
+      gemmPackB(kc, nc, B + pc * rsB + jc * csB, rsB, csB, packedB.data());
+
+      pool.parallelFor(0, parts, [&](const int first, const int last)
+      {
+        for(int part = first; part < last; part++)
+        {
+          T* a = packedA.data() + part * ((MC + MR - 1) / MR) * MR * KC;
+          int packedBlock = -1;
+          for(int tile = part; tile < tiles; tile += parts)
+          {
+            const int ib = tile / nSplit;
+            const int j0 = (tile % nSplit) * share;
+            if(j0 >= nc)
+            {
+              continue;
+            }
+            const int ic = ib * MC;
+            const int mc = (m - ic < MC ? m - ic : MC);
+            const int cols = (nc - j0 < share ? nc - j0 : share);
+            if(ib != packedBlock)
+            {
+              gemmPackA(mc, kc, A + ic * rsA + pc * csA, rsA, csA, a);
+              packedBlock = ib;
+            }
+            gemmMacroKernel(mc, cols, kc, alpha, a, packedB.data() + (j0 / NR) * NR * kc,
+                            C + ic * rsC + (jc + j0) * csC, rsC, csC);
+          }
+        }
+      });
+    }
+  }
+}
+
+/**
+  * @brief   Finds where column col starts in a packed triangle
+  * @pre     None
+  * @post    None
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   n - Order of the triangle
+  * @param   col - Column to find
+  * @return  Index of (col, col) for a lower triangle, (0, col) for an upper
+*/
+inline std::ptrdiff_t packedOffset(const int uplo, const int n, const int col)
+{
+  // col * n passes INT_MAX long before the triangle does
+  const std::ptrdiff_t c = col;
+  return (uplo == LOWER_TRIANGLE ? c * n - c * (c - 1) / 2 : c * (c + 1) / 2);
+}
+
+template<typename T>
+void tpmv(const int uplo, const int trans, const int n, const T* ap, T* x)
+{
+  if(uplo == LOWER_TRIANGLE)
+  {
+    if(trans == NO_TRANSPOSE)
+    {
+      // y(i) = sum L(i, j) x(j), j <= i. From the last column back, the rows
+      // below j already hold their own diagonal terms when j is added in.
+      for(int j = n - 1; j >= 0; j--)
+      {
+        const T* lj = ap + packedOffset(LOWER_TRIANGLE, n, j);
+        const T xj = x[j];
+        x[j] = lj[0] * xj;
+        for(int i = 1; i < n - j; i++)
+        {
+          x[j + i] += lj[i] * xj;
+        }
+      }
+    }
+    else
+    {
+      // y(j) = column j of L dotted with x(j .. n - 1), still untouched
+      for(int j = 0; j < n; j++)
+      {
+        const T* lj = ap + packedOffset(LOWER_TRIANGLE, n, j);
+        T sum = 0;
+        for(int i = 0; i < n - j; i++)
+        {
+          sum += lj[i] * x[j + i];
+        }
+        x[j] = sum;
+      }
+    }
+    return;
+  }
+
+  if(trans == NO_TRANSPOSE)
+  {
+    // y(i) = sum U(i, j) x(j), j >= i
+    for(int j = 0; j < n; j++)
+    {
+      const T* uj = ap + packedOffset(UPPER_TRIANGLE, n, j);
+      const T xj = x[j];
+      for(int i = 0; i < j; i++)
+      {
+        x[i] += uj[i] * xj;
+      }
+      x[j] = uj[j] * xj;
+    }
+  }
+  else
+  {
+    // y(j) = column j of U dotted with x(0 .. j), still untouched
+    for(int j = n - 1; j >= 0; j--)
+    {
+      const T* uj = ap + packedOffset(UPPER_TRIANGLE, n, j);
+      T sum = 0;
+      for(int i = 0; i <= j; i++)
+      {
+        sum += uj[i] * x[i];
+      }
+      x[j] = sum;
+    }
+  }
+}
+
+/**
+  * @brief   Adds columns j0 .. j1 - 1 of a packed symmetric A times x into y
+  * @pre     ap holds the packed lower triangle of an n by n A
+  * @post    y(j0 .. n - 1) has the product of those columns added in
+  * @param   n - Order of A
+  * @param   ap - Packed lower triangle of A
+  * @param   j0 - First column
+  * @param   j1 - One past the last column
+  * @param   x - n values
+  * @param   y - n values
+  * @return  None
+*/
+template<class T>
+__attribute__((always_inline)) inline void spmvColumns(const int n, const T* ap, const int j0,
+                                                       const int j1, const T* x, T* y)
+{
+  int j = j0;
+  for(; j + 1 < j1; j += 2)
+  {
+    // Rows j + 2 on share one pass for both columns, x and y are loaded
+    // once for two entries of A
+    const T* l0 = ap + packedOffset(LOWER_TRIANGLE, n, j) - j;
+    const T* l1 = l0 + n - j - 1;
+    const T x0 = x[j];
+    const T x1 = x[j + 1];
+    T t0 = l0[j] * x0 + l0[j + 1] * x1;
+    T t1 = l0[j + 1] * x0 + l1[j + 1] * x1;
+    for(int i = j + 2; i < n; i++)
+    {
+      const T a0 = l0[i];
+      const T a1 = l1[i];
+      t0 += a0 * x[i];
+      t1 += a1 * x[i];
+      y[i] += a0 * x0 + a1 * x1;
+    }
+    y[j] += t0;
+    y[j + 1] += t1;
+  }
+  if(j < j1)
+  {
+    const T* l0 = ap + packedOffset(LOWER_TRIANGLE, n, j) - j;
+    const T x0 = x[j];
+    T t0 = l0[j] * x0;
+    for(int i = j + 1; i < n; i++)
+    {
+      t0 += l0[i] * x[i];
+      y[i] += l0[i] * x0;
+    }
+    y[j] += t0;
+  }
+}
+
+#ifdef BLAS_HAS_AVX2_KERNEL
+/**
+  * @brief   spmvColumns built for AVX2 and FMA, picked at run time
+  * @pre     The CPU supports AVX2 and FMA
+  * @post    y(j0 .. n - 1) has the product of those columns added in
+  * @param   n - Order of A
+  * @param   ap - Packed lower triangle of A
+  * @param   j0 - First column
+  * @param   j1 - One past the last column
+  * @param   x - n values
+  * @param   y - n values
+  * @return  None
+*/
+__attribute__((target("avx2,fma")))
+inline void spmvColumnsAvx2(const int n, const double* ap, const int j0, const int j1,
+                            const double* x, double* y)
+{
+  spmvColumns(n, ap, j0, j1, x, y);
+}
+#endif
+
+/**
+  * @brief   Picks the spmvColumns this CPU runs fastest
+  * @pre     See spmvColumns
+  * @post    y(j0 .. n - 1) has the product of those columns added in
+  * @param   n - Order of A
+  * @param   ap - Packed lower triangle of A
+  * @param   j0 - First column
+  * @param   j1 - One past the last column
+  * @param   x - n values
+  * @param   y - n values
+  * @return  None
+*/
+template<class T>
+void spmvDispatch(const int n, const T* ap, const int j0, const int j1, const T* x, T* y)
+{
+#ifdef BLAS_HAS_AVX2_KERNEL
+  if constexpr(std::is_same<T, double>::value)
+  {
+    if(hasAvx2Kernel())
+    {
+      spmvColumnsAvx2(n, ap, j0, j1, x, y);
+      return;
+    }
+  }
+#endif
+  spmvColumns(n, ap, j0, j1, x, y);
+}
+
+template<typename T>
+void spmv(const int n, const T* ap, const T* x, T* y, ThreadPool& pool)
+{
+  for(int i = 0; i < n; i++)
+  {
+    y[i] = 0;
+  }
+
+  const int parts = (n < GemmBlocking::SV ? 1 : pool.getThreads());
+  if(parts == 1)
+  {
+    spmvDispatch(n, ap, 0, n, x, y);
+    return;
+  }
+
+  // Part p starts where the columns before it hold p / parts of the entries
+  const double total = 0.5 * n * (n + 1.0);
+  AlignedBuffer<int> start(parts + 1);
+  int* s = start.data();
+  s[0] = 0;
+  int col = 0;
+  double area = 0;
+  for(int p = 1; p < parts; p++)
+  {
+    while(col < n && area < total * p / parts)
+    {
+      area += n - col;
+      col++;
+    }
+    s[p] = col;
+  }
+  s[parts] = n;
+
+  // Part 0 adds straight into y, the others into rows s[p] .. n - 1 of
+  // their own copy
+  AlignedBuffer<T> partial((parts - 1) * n);
+  T* copies = partial.data();
+  pool.parallelFor(0, parts, [&](const int first, const int last)
+  {
+    for(int p = first; p < last; p++)
+    {
+      T* yp = y;
+      if(p > 0)
+      {
+        yp = copies + (p - 1) * n;
+        for(int i = s[p]; i < n; i++)
+        {
+          yp[i] = 0;
+        }
+      }
+      spmvDispatch(n, ap, s[p], s[p + 1], x, yp);
+    }
+  });
+
+  pool.parallelFor(0, n, [&](const int first, const int last)
+  {
+    for(int p = 1; p < parts; p++)
+    {
+      const T* yp = copies + (p - 1) * n;
+      const int from = (first > s[p] ? first : s[p]);
+      for(int i = from; i < last; i++)
+      {
+        y[i] += yp[i];
+      }
+    }
+  });
+}
+
+template<typename T>
+void tpsv(const int uplo, const int trans, const int n, const T* ap, T* x)
+{
+  if(uplo == LOWER_TRIANGLE)
+  {
+    if(trans == NO_TRANSPOSE)
+    {
+      // Forward, x(j) is final once divided and pushed down column j
+      for(int j = 0; j < n; j++)
+      {
+        const T* lj = ap + packedOffset(LOWER_TRIANGLE, n, j);
+        x[j] /= lj[0];
+        const T xj = x[j];
+        for(int i = 1; i < n - j; i++)
+        {
+          x[j + i] -= lj[i] * xj;
+        }
+      }
+    }
+    else
+    {
+      // Back through L^T, row j of L^T is column j of L
+      for(int j = n - 1; j >= 0; j--)
+      {
+        const T* lj = ap + packedOffset(LOWER_TRIANGLE, n, j);
+        T sum = 0;
+        for(int i = 1; i < n - j; i++)
+        {
+          sum += lj[i] * x[j + i];
+        }
+        x[j] = (x[j] - sum) / lj[0];
+      }
+    }
+    return;
+  }
+
+  if(trans == NO_TRANSPOSE)
+  {
+    // Back, x(j) is final once divided and pushed up column j
+    for(int j = n - 1; j >= 0; j--)
+    {
+      const T* uj = ap + packedOffset(UPPER_TRIANGLE, n, j);
+      x[j] /= uj[j];
+      const T xj = x[j];
+      for(int i = 0; i < j; i++)
+      {
+        x[i] -= uj[i] * xj;
+      }
+    }
+  }
+  else
+  {
+    // Forward through U^T, row j of U^T is column j of U
+    for(int j = 0; j < n; j++)
+    {
+      const T* uj = ap + packedOffset(UPPER_TRIANGLE, n, j);
+      T sum = 0;
+      for(int i = 0; i < j; i++)
+      {
+        sum += uj[i] * x[i];
+      }
+      x[j] = (x[j] - sum) / uj[j];
+    }
+  }
+}
+
+/**
+  * @brief   Copies a rows by cols block of a packed triangle that lies in
+              the stored triangle into a column major block
+  * @pre     out holds rows cols values
+  * @post    out(i, j) = A(r0 + i, c0 + j) at out[j * rows + i]
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   n - Order of the triangle
+  * @param   ap - Packed A
+  * @param   r0 - First row
+  * @param   rows - Rows to copy
+  * @param   c0 - First column
+  * @param   cols - Columns to copy
+  * @param   out - Dense copy
+  * @return  None
+*/
+template<class T>
+void tpCopyBlock(const int uplo, const int n, const T* ap, const int r0, const int rows,
+                 const int c0, const int cols, T* out)
+{
+  for(int j = 0; j < cols; j++)
+  {
+    const int col = c0 + j;
+    const T* a = ap + packedOffset(uplo, n, col) + (uplo == LOWER_TRIANGLE ? r0 - col : r0);
+    for(int i = 0; i < rows; i++)
+    {
+      out[j * rows + i] = a[i];
+    }
+  }
+}
+
+/**
+  * @brief   Copies the jb by jb diagonal block at j0 of a packed triangle
+              into a packed triangle of its own
+  * @pre     out holds jb (jb + 1) / 2 values
+  * @post    out is packed the same way as ap
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   n - Order of the triangle
+  * @param   ap - Packed A
+  * @param   j0 - First row and column of the block
+  * @param   jb - Order of the block
+  * @param   out - Packed copy
+  * @return  None
+*/
+template<class T>
+void tpCopyDiagonal(const int uplo, const int n, const T* ap, const int j0, const int jb, T* out)
+{
+  for(int j = 0; j < jb; j++)
+  {
+    const int col = j0 + j;
+    const int length = (uplo == LOWER_TRIANGLE ? jb - j : j + 1);
+    const T* a = ap + packedOffset(uplo, n, col) + (uplo == LOWER_TRIANGLE ? 0 : j0);
+    T* o = out + packedOffset(uplo, jb, j);
+    for(int i = 0; i < length; i++)
+    {
+      o[i] = a[i];
+    }
+  }
+}
+
+/**
+  * @brief   C = C + alpha op(A)[R, C range] X for one off diagonal block,
+              copying the block out of the packed triangle first
+  * @pre     The block lies in the stored triangle of op(A)
+  * @post    C is updated
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   trans - NO_TRANSPOSE for A, TRANSPOSE for A^T
+  * @param   n - Order of A
+  * @param   ap - Packed A
+  * @param   r0 - First row of op(A)
+  * @param   rows - Rows of the block
+  * @param   c0 - First column of op(A)
+  * @param   cols - Columns of the block
+  * @param   alpha - Scales the product
+  * @param   X - cols by k block
+  * @param   C - rows by k block
+  * @param   k - Right hand sides
+  * @param   ldb - Distance between columns of X and C
+  * @param   work - Holds rows cols values
+  * @param   pool - Threads to use
+  * @return  None
+*/
+template<class T>
+void tpGemm(const int uplo, const int trans, const int n, const T* ap, const int r0,
+            const int rows, const int c0, const int cols, const T alpha, const T* X,
+            T* C, const int k, const int ldb, T* work, ThreadPool& pool)
+{
+  if(rows <= 0 || cols <= 0)
+  {
+    return;
+  }
+  if(trans == NO_TRANSPOSE)
+  {
+    tpCopyBlock(uplo, n, ap, r0, rows, c0, cols, work);
+    gemm(rows, k, cols, alpha, work, 1, rows, X, 1, ldb, static_cast<T>(1), C, 1, ldb, pool);
+  }
+  else
+  {
+    // op(A)[R, C] = A[C, R]^T, so the copy is read with its strides swapped
+    tpCopyBlock(uplo, n, ap, c0, cols, r0, rows, work);
+    gemm(rows, k, cols, alpha, work, cols, 1, X, 1, ldb, static_cast<T>(1), C, 1, ldb, pool);
+  }
+}
+
+template<typename T>
+void tpsm(const int uplo, const int trans, const int n, const T* ap, const int k,
+          T* B, const int ldb, ThreadPool& pool)
+{
+  if(n <= 0 || k <= 0)
+  {
+    return;
+  }
+
+  const int TB = GemmBlocking::TB;
+  // op(A) is lower triangular when exactly one of the two holds
+  const bool forward = ((uplo == LOWER_TRIANGLE) == (trans == NO_TRANSPOSE));
+  const int blocks = (n + TB - 1) / TB;
+  AlignedBuffer<T> diagonal(TB * (TB + 1) / 2);
+  AlignedBuffer<T> work(TB * n);
+
+  for(int step = 0; step < blocks; step++)
+  {
+    const int b = (forward ? step : blocks - 1 - step);
+    const int j0 = b * TB;
+    const int jb = (n - j0 < TB ? n - j0 : TB);
+
+    tpCopyDiagonal(uplo, n, ap, j0, jb, diagonal.data());
+    pool.parallelFor(0, k, [&](const int first, const int last)
+    {
+      for(int c = first; c < last; c++)
+      {
+        tpsv(uplo, trans, jb, diagonal.data(), B + c * ldb + j0);
+      }
+    });
+
+    // Push the solved block into the rows still to be solved
+    if(forward)
+    {
+      tpGemm(uplo, trans, n, ap, j0 + jb, n - j0 - jb, j0, jb, static_cast<T>(-1),
+             B + j0, B + j0 + jb, k, ldb, work.data(), pool);
+    }
+    else
+    {
+      tpGemm(uplo, trans, n, ap, 0, j0, j0, jb, static_cast<T>(-1),
+             B + j0, B, k, ldb, work.data(), pool);
+    }
+  }
+}
+
+template<typename T>
+void tpmm(const int uplo, const int trans, const int n, const T* ap, const int k,
+          T* B, const int ldb, ThreadPool& pool)
+{
+  if(n <= 0 || k <= 0)
+  {
+    return;
+  }
+
+  const int TB = GemmBlocking::TB;
+  const bool lowerShape = ((uplo == LOWER_TRIANGLE) == (trans == NO_TRANSPOSE));
+  const int blocks = (n + TB - 1) / TB;
+  AlignedBuffer<T> diagonal(TB * (TB + 1) / 2);
+  AlignedBuffer<T> work(TB * n);
+
+  // Block i needs the blocks it reads still untouched, so a lower op(A)
+  // runs from the bottom and an upper one from the top
+  for(int step = 0; step < blocks; step++)
+  {
+    const int b = (lowerShape ? blocks - 1 - step : step);
+    const int i0 = b * TB;
+    const int ib = (n - i0 < TB ? n - i0 : TB);
+
+    tpCopyDiagonal(uplo, n, ap, i0, ib, diagonal.data());
+    pool.parallelFor(0, k, [&](const int first, const int last)
+    {
+      for(int c = first; c < last; c++)
+      {
+        tpmv(uplo, trans, ib, diagonal.data(), B + c * ldb + i0);
+      }
+    });
+
+    if(lowerShape)
+    {
+      tpGemm(uplo, trans, n, ap, i0, ib, 0, i0, static_cast<T>(1),
+             B, B + i0, k, ldb, work.data(), pool);
+    }
+    else
+    {
+      tpGemm(uplo, trans, n, ap, i0, ib, i0 + ib, n - i0 - ib, static_cast<T>(1),
+             B + i0 + ib, B + i0, k, ldb, work.data(), pool);
+    }
+  }
+}
+
+template<typename T>
+int potrf(const int n, T* a, const int lda)
+{
+  for(int j = 0; j < n; j++)
+  {
+    // L(j .. n - 1, j) -= L(j, k) L(j .. n - 1, k), skipping zeros of a band
+    T* aj = a + j * lda;
+    for(int k = 0; k < j; k++)
+    {
+      const T* ak = a + k * lda;
+      const T ljk = ak[j];
+      if(ljk == 0)
+      {
+        continue;
+      }
+      for(int i = j; i < n; i++)
+      {
+        aj[i] -= ljk * ak[i];
+      }
+    }
+
+    if(aj[j] <= 0)
+    {
+      return j + 1;
+    }
+    aj[j] = std::sqrt(aj[j]);
+    for(int i = j + 1; i < n; i++)
+    {
+      aj[i] /= aj[j];
+    }
+  }
+
+  return 0;
+}
+
+template<typename T>
+void trsmRight(const int m, const int n, const T* l, const int ldl, T* b, const int ldb,
+               ThreadPool& pool)
+{
+  // Column j of X is B(:, j) less X(:, p) L(j, p) for every p < j, over L(j, j)
+  const int TS = GemmBlocking::TS;
+  for(int j0 = 0; j0 < n; j0 += TS)
+  {
+    const int jb = (n - j0 < TS ? n - j0 : TS);
+    if(j0 > 0)
+    {
+      // L^T(p, q) is L(j0 + q, p), so L is read with its strides swapped
+      gemm(m, jb, j0, static_cast<T>(-1), b, 1, ldb, l + j0, ldl, 1,
+           static_cast<T>(1), b + j0 * ldb, 1, ldb, pool);
+    }
+
+    for(int j = j0; j < j0 + jb; j++)
+    {
+      T* bj = b + j * ldb;
+      for(int p = j0; p < j; p++)
+      {
+        const T ljp = l[p * ldl + j];
+        if(ljp == 0)
+        {
+          continue;
+        }
+        const T* bp = b + p * ldb;
+        for(int i = 0; i < m; i++)
+        {
+          bj[i] -= ljp * bp[i];
+        }
+      }
+      const T ljj = l[j * ldl + j];
+      for(int i = 0; i < m; i++)
+      {
+        bj[i] /= ljj;
+      }
+    }
+  }
+}
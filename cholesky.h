@@ -0,0 +1,92 @@
+/**
+  * @file   cholesky.h
+  * @author Dylan Warren, Section A
+  * @brief  The Cholesky factor of a SymMatrix, A = L L^T, kept so it can
+            solve for any number of right hand sides.
+*/
+/**
+  * @class  CholeskyFactor
+  * @brief  CholeskyFactor factors once and owns L. A is cut into TILE by
+  *         TILE tiles and factored by POTRF, TRSM, SYRK and GEMM tile tasks
+  *         on a TaskGraph, each task waiting only on the tiles it reads.
+  *         Both substitutions walk the columns of L as they are stored,
+  *         L^T is never built.
+*/
+#ifndef CHOLESKY_H
+#define CHOLESKY_H
+
+#include <stdexcept>
+#include "./lower.h"
+#include "./symmetric.h"
+#include "./dense.h"
+#include "./threadpool.h"
+#include "./taskgraph.h"
+
+template<class T>
+class CholeskyFactor
+{
+  private:
+    LowerTriangle<T> m_L;
+    bool m_positiveDefinite;
+    ThreadPool* m_pool;
+    /** Order of the tiles A is factored in */
+    static const int TILE = 128;
+  public:
+    /**
+      * @brief   Factors source by tiles, the tile tasks run across pool. A
+                  pivot that is not positive stops the factorization, the
+                  tasks left skip their work and only solving is refused.
+      * @pre     None
+      * @post    The factor is ready to solve with if isPositiveDefinite()
+      * @param   source - Matrix "A"
+      * @param   pool - Threads to factor and solve many right hand sides with
+      * @return  None
+      * @throw   If source is not square
+    */
+    CholeskyFactor(const SymMatrix<T>& source, ThreadPool& pool = ThreadPool::global());
+    /**
+      * @brief   Gets the order of A
+      * @pre     None
+      * @post    None
+      * @return  Rows of A
+    */
+    int getSize() const { return m_L.getRow(); }
+    /**
+      * @brief   Gets the factor
+      * @pre     None
+      * @post    None
+      * @return  L
+    */
+    const LowerTriangle<T>& getL() const { return m_L; }
+    /**
+      * @brief   Tells if every pivot was positive, so L was finished
+      * @pre     None
+      * @post    None
+      * @return  m_positiveDefinite
+    */
+    bool isPositiveDefinite() const { return m_positiveDefinite; }
+    /**
+      * @brief   Solves A x = B with one forward and one back substitution
+      * @pre     None
+      * @post    None
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If B does not match A or A is not positive definite
+    */
+    vector<T> solve(const vector<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B with two blocked tpsm
+                  passes, L X' = B then L^T X = X' 
+      * @pre     None
+      * @post    None
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If B does not match A or A is not positive definite
+    */
+    template<class Layout>
+    DenseMatrix<T, Layout> solve(const DenseMatrix<T, Layout>& B) const;
+};
+
+#include "./cholesky.hpp"
+
+#endif
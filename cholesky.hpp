@@ -0,0 +1,201 @@
+/**
+  * @file   cholesky.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the Cholesky factorization and its solves
+*/
+#include <cmath>
+#include <atomic>
+
+template<typename T>
+CholeskyFactor<T>::CholeskyFactor(const SymMatrix<T>& source, ThreadPool& pool)
+  : m_L(source.getRow(), source.getCol()), m_positiveDefinite(true), m_pool(&pool)
+{
+  if(source.getRow() != source.getCol())
+  {
+    std::cerr << "Cannot Cholesky factor a SymMatrix that is not square" << std::endl;
+    throw std::out_of_range("MATRIX NOT SQUARE; CHOLESKY");
+  }
+
+  const int n = source.getRow();
+  if(n == 0)
+  {
+    return;
+  }
+
+  // Tiles need A(i, j) at a[j * ld + i], so the lower half is spread out
+  DenseMatrix<T> work(n, n);
+  T* a = work.data();
+  const int ld = work.getLd();
+  for(int col = 0; col < n; col++)
+  {
+    const T* aj = source.column(col);
+    for(int i = 0; i < n - col; i++)
+    {
+      a[col * ld + col + i] = aj[i];
+    }
+  }
+
+  const int tiles = (n + TILE - 1) / TILE;
+  auto tile = [&](const int col, const int row) { return a + col * TILE * ld + row * TILE; };
+  auto order = [&](const int t) { return (n - t * TILE < TILE ? n - t * TILE : TILE); };
+
+  // Tile (i, j) with i >= j is written by one task after another, the last
+  // of them is what the next reader or writer of the tile waits on
+  vector<int> last(tiles * (tiles + 1) / 2);
+  for(int t = 0; t < last.getSize(); t++)
+  {
+    last[t] = -1;
+  }
+  auto slot = [&](const int i, const int j) -> int& { return last[i * (i + 1) / 2 + j]; };
+  vector<int> solved(tiles);
+
+  // Set by the POTRF that fails, every task after it returns straight away
+  std::atomic<bool> broken(false);
+  ThreadPool serial(1);
+  TaskGraph graph;
+  for(int k = 0; k < tiles; k++)
+  {
+    const int kb = order(k);
+    const int diagonal = graph.add([=, &broken]
+    {
+      if(!broken.load() && potrf(kb, tile(k, k), ld) != 0)
+      {
+        broken.store(true);
+      }
+    });
+    if(slot(k, k) >= 0)
+    {
+      graph.depend(slot(k, k), diagonal);
+    }
+    slot(k, k) = diagonal;
+
+    for(int i = k + 1; i < tiles; i++)
+    {
+      const int ib = order(i);
+      const int trsm = graph.add([=, &serial, &broken]
+      {
+        if(broken.load())
+        {
+          return;
+        }
+        trsmRight(ib, kb, tile(k, k), ld, tile(k, i), ld, serial);
+      });
+      graph.depend(diagonal, trsm);
+      if(slot(i, k) >= 0)
+      {
+        graph.depend(slot(i, k), trsm);
+      }
+      slot(i, k) = trsm;
+      solved[i] = trsm;
+    }
+
+    // SYRK when j == i, GEMM below the diagonal
+    for(int i = k + 1; i < tiles; i++)
+    {
+      for(int j = k + 1; j <= i; j++)
+      {
+        const int ib = order(i);
+        const int jb = order(j);
+        const int update = graph.add([=, &serial, &broken]
+        {
+          if(broken.load())
+          {
+            return;
+          }
+          // tile(i, j) -= tile(i, k) tile(j, k)^T, the second read transposed
+          gemm(ib, jb, kb, static_cast<T>(-1), tile(k, i), 1, ld, tile(k, j), ld, 1,
+               static_cast<T>(1), tile(j, i), 1, ld, serial);
+        });
+        graph.depend(solved[j], update);
+        if(j != i)
+        {
+          graph.depend(solved[i], update);
+        }
+        if(slot(i, j) >= 0)
+        {
+          graph.depend(slot(i, j), update);
+        }
+        slot(i, j) = update;
+      }
+    }
+  }
+  graph.run(pool);
+  if(broken.load())
+  {
+    m_positiveDefinite = false;
+    return;
+  }
+
+  for(int col = 0; col < n; col++)
+  {
+    T* lj = m_L.column(col);
+    for(int i = 0; i < n - col; i++)
+    {
+      lj[i] = a[col * ld + col + i];
+    }
+  }
+}
+
+template<typename T>
+vector<T> CholeskyFactor<T>::solve(const vector<T>& B) const
+{
+  if(B.getSize() != getSize())
+  {
+    std::cerr << "Vector B size does not match the Cholesky size." << std::endl;
+    throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE; CHOLESKY");
+  }
+  if(!m_positiveDefinite)
+  {
+    std::cerr << "SymMatrix is not positive definite" << std::endl;
+    throw std::runtime_error("NOT POSITIVE DEFINITE; CHOLESKY");
+  }
+
+  vector<T> x(B);
+  tpsv(LOWER_TRIANGLE, NO_TRANSPOSE, getSize(), m_L.column(0), x.data());
+  tpsv(LOWER_TRIANGLE, TRANSPOSE, getSize(), m_L.column(0), x.data());
+
+  return x;
+}
+
+template<typename T>
+template<class Layout>
+DenseMatrix<T, Layout> CholeskyFactor<T>::solve(const DenseMatrix<T, Layout>& B) const
+{
+  if(B.getRow() != getSize())
+  {
+    std::cerr << "Matrix B rows do not match the Cholesky size." << std::endl;
+    throw std::out_of_range("MISS MATCHING MATRIX SIZES; CHOLESKY");
+  }
+  if(!m_positiveDefinite)
+  {
+    std::cerr << "SymMatrix is not positive definite" << std::endl;
+    throw std::runtime_error("NOT POSITIVE DEFINITE; CHOLESKY");
+  }
+
+  const int n = getSize();
+  const int k = B.getCol();
+  DenseMatrix<T> work(n, k);
+  T* w = work.data();
+  const int ld = work.getLd();
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      w[col * ld + row] = B(col, row);
+    }
+  }
+
+  tpsm(LOWER_TRIANGLE, NO_TRANSPOSE, n, m_L.column(0), k, w, ld, *m_pool);
+  tpsm(LOWER_TRIANGLE, TRANSPOSE, n, m_L.column(0), k, w, ld, *m_pool);
+
+  DenseMatrix<T, Layout> X(n, k);
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      X(col, row) = w[col * ld + row];
+    }
+  }
+
+  return X;
+}
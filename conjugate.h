@@ -0,0 +1,123 @@
+/**
+  * @file   conjugate.h
+  * @author Dylan Warren, Section A
+  * @brief  The conjugate class is a "functor" class, it iteratively solves a
+            symmetric positive definite system of equations.
+*/
+/**
+  * @class  ConjugateGradientSolver
+  * @brief  ConjugateGradientSolver finds the x vector with preconditioned
+  *         conjugate gradient. A only has to be multiplied by vectors, so it
+  *         can be any matrix in this project or a PoissonOperator.
+*/
+#ifndef CONJUGATE_H
+#define CONJUGATE_H
+
+#include "./preconditioner.h"
+#include "./poisson.h"
+#include "./symmetric.h"
+
+template<class T>
+class ConjugateGradientSolver
+{
+  private:
+    T m_tolerance;
+    int m_maxIterations;
+    int m_iterations;
+    T m_residual;
+    /**
+      * @brief   Computes y = A x for any matrix with a vector operator*
+      * @pre     x and y must match the size of A
+      * @post    y is overwritten
+      * @param   A - Matrix to multiply
+      * @param   x - Vector to multiply
+      * @param   y - Vector to store the product in
+      * @return  None
+    */
+    template<class Matrix>
+    static void multiply(const Matrix& A, const vector<T>& x, vector<T>& y) { y = A * x; }
+    /**
+      * @brief   Computes y = A x in place for the matrix free operator
+      * @pre     x and y must match the size of A
+      * @post    y is overwritten
+      * @param   A - Operator to apply
+      * @param   x - Vector to multiply
+      * @param   y - Vector to store the product in
+      * @return  None
+    */
+    static void multiply(const PoissonOperator<T>& A, const vector<T>& x, vector<T>& y) { A.apply(x, y); }
+    /**
+      * @brief   Computes y = A x in place with spmv, nothing is allocated
+      * @pre     x and y must match the size of A
+      * @post    y is overwritten
+      * @param   A - Matrix to multiply
+      * @param   x - Vector to multiply
+      * @param   y - Vector to store the product in
+      * @return  None
+    */
+    static void multiply(const SymMatrix<T>& A, const vector<T>& x, vector<T>& y)
+    { spmv(A.getRow(), A.column(0), x.data(), y.data()); }
+  public:
+    /**
+      * @brief   Sets when the solver stops
+      * @pre     tolerance must be positive, maxIterations zero or greater
+      * @post    Creates a solver
+      * @param   tolerance - Stop once ||B - A x|| / ||B|| is below this
+      * @param   maxIterations - Most iterations to run, 0 means the size of A
+      * @return  None
+      * @throw   If tolerance is not positive or maxIterations is negative
+    */
+    ConjugateGradientSolver(const T tolerance = static_cast<T>(1e-10),
+                            const int maxIterations = 0);
+    /**
+      * @brief   Solves A x = B starting from x = 0
+      * @pre     A must be symmetric positive definite, M must approximate A
+      * @post    getIterations and getResidual describe this solve
+      * @param   A - Matrix "A" in the equation
+      * @param   B - Vector "B" in the equation
+      * @param   M - Preconditioner with apply(r, z) solving M z = r
+      * @return  The solved x vector, the last iterate if it never converged
+      * @throw   If B does not match the size of A
+    */
+    template<class Matrix, class Preconditioner>
+    vector<T> operator()(const Matrix& A, const vector<T>& B, const Preconditioner& M);
+    /**
+      * @brief   Solves A x = B with plain conjugate gradient
+      * @pre     A must be symmetric positive definite
+      * @post    getIterations and getResidual describe this solve
+      * @param   A - Matrix "A" in the equation
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector, the last iterate if it never converged
+      * @throw   If B does not match the size of A
+    */
+    template<class Matrix>
+    vector<T> operator()(const Matrix& A, const vector<T>& B)
+    {
+      return this->operator()(A, B, IdentityPreconditioner<T>());
+    }
+    /**
+      * @brief   Gets how many iterations the last solve took
+      * @pre     None
+      * @post    None
+      * @return  m_iterations
+    */
+    int getIterations() const { return m_iterations; }
+    /**
+      * @brief   Gets ||B - A x|| / ||B|| from the end of the last solve
+      * @pre     None
+      * @post    None
+      * @return  m_residual
+    */
+    T getResidual() const { return m_residual; }
+    /**
+      * @brief   Checks if the last solve reached the tolerance
+      * @pre     None
+      * @post    None
+      * @return  True if the final residual is under the tolerance
+    */
+    bool converged() const { return m_residual <= m_tolerance; }
+};
+
+#include "./conjugate.hpp"
+
+#endif
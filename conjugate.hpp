@@ -0,0 +1,121 @@
+/**
+  * @file   conjugate.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the () operator for preconditioned conjugate gradient
+*/
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+template<typename T>
+ConjugateGradientSolver<T>::ConjugateGradientSolver(const T tolerance,
+                                                    const int maxIterations)
+{
+  if(tolerance <= 0 || maxIterations < 0)
+  {
+    std::cerr << "Tolerance must be positive and iterations not negative" << std::endl;
+    throw std::out_of_range("BAD STOPPING CRITERIA; CG");
+  }
+
+  m_tolerance = tolerance;
+  m_maxIterations = maxIterations;
+  m_iterations = 0;
+  m_residual = 0;
+}
+
+template<typename T>
+template<class Matrix, class Preconditioner>
+vector<T> ConjugateGradientSolver<T>::operator()(const Matrix& A, const vector<T>& B,
+                                                 const Preconditioner& M)
+{
+  if(A.getRow() != B.getSize() || A.getCol() != B.getSize())
+  {
+    std::cerr << "CG matrix size does not match vector size" << std::endl;
+    throw std::out_of_range("MATRIX SIZE DOES NOT MATCH VECTOR SIZE; CG");
+  }
+
+  const int n = B.getSize();
+  const int maxIterations = (m_maxIterations > 0 ? m_maxIterations : n);
+
+  vector<T> x(n);
+  vector<T> r(B);
+  vector<T> z(n);
+  vector<T> p(n);
+  vector<T> q(n);
+  T* xp = x.data();
+  T* rp = r.data();
+  T* zp = z.data();
+  T* pp = p.data();
+
+  T bNorm = 0;
+  for(int i = 0; i < n; i++)
+  {
+    xp[i] = 0;
+    bNorm += rp[i] * rp[i];
+  }
+  bNorm = std::sqrt(bNorm);
+
+  m_iterations = 0;
+  m_residual = 0;
+  if(bNorm == 0)
+  {
+    return x;
+  }
+
+  // x = 0 so r = B, z = M^-1 r and the first direction is z
+  M.apply(r, z);
+  T rz = 0;
+  for(int i = 0; i < n; i++)
+  {
+    pp[i] = zp[i];
+    rz += rp[i] * zp[i];
+  }
+  m_residual = 1;
+
+  while(m_iterations < maxIterations && m_residual > m_tolerance)
+  {
+    multiply(A, p, q);
+    const T* qp = q.data();
+
+    T pq = 0;
+    for(int i = 0; i < n; i++)
+    {
+      pq += pp[i] * qp[i];
+    }
+    if(pq <= 0)
+    {
+      std::cerr << "CG found a direction with p^T A p <= 0" << std::endl;
+      throw std::runtime_error("NOT POSITIVE DEFINITE; CG");
+    }
+
+    const T alpha = rz / pq;
+    T rNorm = 0;
+    for(int i = 0; i < n; i++)
+    {
+      xp[i] += alpha * pp[i];
+      rp[i] -= alpha * qp[i];
+      rNorm += rp[i] * rp[i];
+    }
+    m_iterations++;
+    m_residual = std::sqrt(rNorm) / bNorm;
+    if(m_residual <= m_tolerance)
+    {
+      break;
+    }
+
+    M.apply(r, z);
+    T rzNext = 0;
+    for(int i = 0; i < n; i++)
+    {
+      rzNext += rp[i] * zp[i];
+    }
+    const T beta = rzNext / rz;
+    rz = rzNext;
+    for(int i = 0; i < n; i++)
+    {
+      pp[i] = zp[i] + beta * pp[i];
+    }
+  }
+
+  return x;
+}
@@ -5,45 +5,207 @@
 */
 /**
   * @class  DenseMatrix
-  * @brief  DenseMatrix Allows us to do add/sub/mult of DenseMatrix
+  * @brief  DenseMatrix Allows us to do add/sub/mult of DenseMatrix. All
+  *         entries sit in one aligned block, ordered by the Layout policy,
+  *         with getLd() values between the starts of neighbouring columns
+  *         (ColMajor) or rows (RowMajor).
+*/
+/**
+  * @class  DenseColumn
+  * @brief  DenseColumn is what DenseMatrix[col] gives back, one column of
+  *         the block, so m[col][row] works in either layout.
+*/
+/**
+  * @class  DenseView
+  * @brief  DenseView is a rows by cols window into a DenseMatrix that keeps
+  *         its leading dimension. It owns nothing and copies nothing.
 */
 
 #ifndef DENSE_H
 #define DENSE_H
 
+#include <type_traits>
+#include "./aligned.h"
+#include "./blas.h"
 #include "./upper.h"
 #include "./lower.h"
 #include "./symmetric.h"
 #include "./tridiagonal.h"
+#include "./sparse.h"
+
+/** Columns are contiguous, A(col, row) is at col * ld + row */
+struct ColMajor
+{
+  static int index(const int col, const int row, const int ld) { return col * ld + row; }
+  static int leading(const int rows, const int) { return rows; }
+  static int rowStride(const int) { return 1; }
+  static int colStride(const int ld) { return ld; }
+};
+
+/** Rows are contiguous, A(col, row) is at row * ld + col */
+struct RowMajor
+{
+  static int index(const int col, const int row, const int ld) { return row * ld + col; }
+  static int leading(const int, const int cols) { return cols; }
+  static int rowStride(const int ld) { return ld; }
+  static int colStride(const int) { return 1; }
+};
 
 template<class T>
-class DenseMatrix : public matrix<DenseMatrix<T>, T>
+class DenseColumn
+{
+  private:
+    T* m_data;
+    int m_size;
+    int m_stride;
+  public:
+    /**
+      * @brief   Points at one column of a matrix block
+      * @pre     data must hold (size - 1) * stride + 1 values
+      * @post    None
+      * @param   data - First entry of the column
+      * @param   size - Rows in the column
+      * @param   stride - Values between one row and the next
+      * @return  None
+    */
+    DenseColumn(T* data, const int size, const int stride)
+      : m_data(data), m_size(size), m_stride(stride) {};
+    DenseColumn(const DenseColumn& source) = default;
+    /**
+      * @brief   Gets an entry of the column
+      * @pre     row must be in the column
+      * @post    None
+      * @param   row - Which row
+      * @return  The entry, changeable unless the matrix was const
+      * @throw   If row is lower than zero or not less than getSize()
+    */
+    T& operator[](const int row) const;
+    /**
+      * @brief   Gets the column length
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getSize() const { return m_size; }
+    /**
+      * @brief   Copies the entries of another column in
+      * @pre     Sizes must match
+      * @post    The column holds the values of source
+      * @param   source - Column to copy
+      * @return  *this
+      * @throw   If the sizes do not match
+    */
+    DenseColumn& operator=(const DenseColumn& source);
+    template<class U>
+    DenseColumn& operator=(const DenseColumn<U>& source);
+    /**
+      * @brief   Copies a vector into the column
+      * @pre     Sizes must match
+      * @post    The column holds the values of source
+      * @param   source - Vector to copy
+      * @return  *this
+      * @throw   If the sizes do not match
+    */
+    DenseColumn& operator=(const vector<std::remove_const_t<T>>& source);
+    /**
+      * @brief   Copies the column out into a vector
+      * @pre     None
+      * @post    None
+      * @return  A vector holding the column
+    */
+    operator vector<std::remove_const_t<T>>() const;
+};
+
+template<class T, class Layout = ColMajor>
+class DenseView
+{
+  private:
+    T* m_data;
+    int m_rows;
+    int m_cols;
+    int m_ld;
+  public:
+    /**
+      * @brief   Makes a window over a block
+      * @pre     The block must outlive the view
+      * @post    None
+      * @param   data - Entry (0, 0) of the window
+      * @param   rows - Rows in the window
+      * @param   cols - Cols in the window
+      * @param   ld - Leading dimension of the block
+      * @return  None
+    */
+    DenseView(T* data, const int rows, const int cols, const int ld)
+      : m_data(data), m_rows(rows), m_cols(cols), m_ld(ld) {};
+    int getRow() const { return m_rows; }
+    int getCol() const { return m_cols; }
+    int getLd() const { return m_ld; }
+    T* data() const { return m_data; }
+    /**
+      * @brief   Gets an entry of the window, no bounds check
+      * @pre     col and row must be in the window
+      * @post    None
+      * @param   col - column of the window
+      * @param   row - row of the window
+      * @return  The entry
+    */
+    T& operator()(const int col, const int row) const
+    {
+      return m_data[Layout::index(col, row, m_ld)];
+    }
+    /**
+      * @brief   Narrows the window further
+      * @pre     The new window must fit in this one
+      * @post    None
+      * @param   col - First column
+      * @param   row - First row
+      * @param   cols - How many columns
+      * @param   rows - How many rows
+      * @return  A view sharing this block
+      * @throw   If the window does not fit
+    */
+    DenseView view(const int col, const int row, const int cols, const int rows) const;
+};
+
+template<class T, class Layout = ColMajor>
+class DenseMatrix : public matrix<DenseMatrix<T, Layout>, T>
 {
   private:
     int m_rows;
     int m_cols;
-    vector<vector<T>> ptr_to_data;
+    int m_ld;
+    AlignedBuffer<T> m_data;
+    /**
+      * @brief   Unchecked entry access
+      * @pre     col and row must be in bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  The entry
+    */
+    T& at(const int col, const int row) { return m_data.data()[Layout::index(col, row, m_ld)]; }
+    const T& at(const int col, const int row) const { return m_data.data()[Layout::index(col, row, m_ld)]; }
   public:
     /**
-      * @brief   Sets row and col to 0 and sets our point to nullptr
+      * @brief   Sets row and col to 0 and holds no entries
       * @pre     None
       * @post    All member variables are set.
       * @return  None
     */
-    DenseMatrix() : m_rows(0), m_cols(0), ptr_to_data(vector<vector<T>>()) {};
+    DenseMatrix() : m_rows(0), m_cols(0), m_ld(0), m_data(AlignedBuffer<T>()) {};
     /**
       * @brief   Confirms DenseMatrix row and col are proper values
-                  then initialises ptr_to_vector
+                  then allocates one zeroed block for every entry
       * @pre     rows and cols must be greater than zero
       * @post    Creates a fresh DenseMatrix of size rows and cols
       * @param   r - How tall the DenseMatrix should be
       * @param   c - How many vectors wide it should be
       * @return  None
-      * @throw   If r or r is 0 or less
+      * @throw   If r or r is 0 or less or r c is more than an int counts
     */
     DenseMatrix(const int r, const int c);
     /**
-      * @brief   Sets ptr_to_vector equal to sources after seting row and col
+      * @brief   Copies the block of source
       * @pre     None
       * @post    Creates a new DenseMatrix object that is identical to source
       * @param   source - DenseMatrix to copy
@@ -51,7 +213,7 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
     */
     DenseMatrix(const DenseMatrix& source) = default;
     /**
-      * @brief   Sets ptr_to_vector equal to other after seting row and col
+      * @brief   Takes the block of other
       * @pre     None
       * @post    Moves other's data into C.O
       * @param   other - DenseMatrix to move
@@ -73,18 +235,34 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
     */
     int getCol() const { return m_cols; }
     /**
-      * @brief   Sets DenseMatrix row size
+      * @brief   Gets the values between neighbouring columns (ColMajor) or
+                  rows (RowMajor) of the block
+      * @pre     None
+      * @post    None
+      * @return  m_ld
+    */
+    int getLd() const { return m_ld; }
+    /**
+      * @brief   Gets the block, entry (col, row) is at Layout::index(col, row, getLd())
+      * @pre     None
+      * @post    None
+      * @return  The first entry, 64 byte aligned
+    */
+    T* data() { return m_data.data(); }
+    const T* data() const { return m_data.data(); }
+    /**
+      * @brief   Sets DenseMatrix row size, keeping the entries that still fit
       * @pre     request sized must be greater than zero
-      * @post    m_rows is set
+      * @post    m_rows is set, new entries are zero
       * @param   r - desired amount of rows
       * @return  None
       * @throw   If r is less than 1
     */
     void setRow(const int r);
     /**
-      * @brief   Sets DenseMatrix col size
+      * @brief   Sets DenseMatrix col size, keeping the entries that still fit
       * @pre     request sized must be greater than zero
-      * @post    m_cols is set
+      * @post    m_cols is set, new entries are zero
       * @param   c - desired amount of cols
       * @return  None
       * @throw   If c is less than 1
@@ -107,26 +285,26 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
     */
     DenseMatrix& operator=(DenseMatrix&& other) = default;
     /**
-      * @brief   Allows the ability to change the vector returned from using []
+      * @brief   Allows the ability to change the column returned from using []
       * @pre     index must be greater than or equal to zero and less than m_cols
-      * @post    The vector accessed is able to be changed
-      * @param   index - Used to access ptr_to_vector
-      * @return  A position in ptr_to_vector
+      * @post    The column accessed is able to be changed
+      * @param   index - Which column
+      * @return  The column, m[col][row] is entry (col, row)
       * @throw   If index is lower than zero or larger than m_cols
     */
-    vector<T>& operator[](const int index);
+    DenseColumn<T> operator[](const int index);
     /**
-      * @brief   Allows the ability to read from ptr_to_vector
+      * @brief   Allows the ability to read a column
       * @pre     index must be greater than or equal to zero and less than m_cols
       * @post    None
-      * @param   index - Used to access ptr_to_vector
-      * @return  A vector from ptr_to_vector
+      * @param   index - Which column
+      * @return  The column, read only
       * @throw   If index is lower than zero or larger than m_cols
     */
-    const vector<T>& operator[](const int index) const;
+    DenseColumn<const T> operator[](const int index) const;
     /**
       * @brief   Allows access to matrix elements.
-      * @pre     col and row must be within bounds 
+      * @pre     col and row must be within bounds
       * @post    None
       * @param   col - column of the matrix
       * @param   row - row of the matrix
@@ -134,6 +312,30 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
       * @throw   IF col or row are out of bounds
     */
     T operator()(const int col, const int row) const;
+    /**
+      * @brief   Allows changing matrix elements.
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  The entry at col, row
+      * @throw   IF col or row are out of bounds
+    */
+    T& operator()(const int col, const int row);
+    /**
+      * @brief   Makes a window onto part of the matrix, sharing its block
+      * @pre     The window must fit in the matrix
+      * @post    None
+      * @param   col - First column
+      * @param   row - First row
+      * @param   cols - How many columns
+      * @param   rows - How many rows
+      * @return  A view with the leading dimension of the matrix
+      * @throw   If the window does not fit
+    */
+    DenseView<T, Layout> view(const int col, const int row, const int cols, const int rows);
+    DenseView<const T, Layout> view(const int col, const int row, const int cols,
+                                    const int rows) const;
     /**
       * @brief   Checks if the current DenseMatrix is an upper matrix
       * @pre     None
@@ -190,6 +392,14 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
       * @return  A new LowerTriangle
     */
     TriDiag<T> toTri() const;
+    /**
+      * @brief   Converts current DenseMatrix into a SparseMatrix
+      * @pre     isSym() is true when symmetric is set
+      * @post    None
+      * @param   symmetric - Only keep the lower triangle
+      * @return  A new SparseMatrix holding the non zero entries
+    */
+    SparseMatrix<T> toSparse(const bool symmetric = false) const;
 
 };
 
@@ -202,8 +412,8 @@ class DenseMatrix : public matrix<DenseMatrix<T>, T>
   * @return  New DenseMatrix that is lhs and rhs added together
   * @throw   If matrices are not same dimensions
 */
-template<typename T>
-DenseMatrix<T> operator+(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator+(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs);
 
 /**
   * @brief   Subtract two matrices
@@ -214,11 +424,12 @@ DenseMatrix<T> operator+(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
   * @return  New DenseMatrix that is rhs subtracted from lhs
   * @throw   If matrices are not same dimensions
 */
-template<typename T>
-DenseMatrix<T> operator-(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator-(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs);
 
 /**
-  * @brief   Multiply two matrices together
+  * @brief   Multiply two matrices together, streaming down columns (ColMajor)
+              or along rows (RowMajor) of the block
   * @pre     None
   * @post    None
   * @param   lhs - Matrix left of *
@@ -226,8 +437,8 @@ DenseMatrix<T> operator-(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
   * @return  New DenseMatrix that is lhs times rhs
   * @throw   If matrices are not same dimensions
 */
-template<typename T>
-DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs);
 
 /**
   * @brief   Multiply a DenseMatrix by a scalar
@@ -237,8 +448,8 @@ DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs);
   * @param   rhs - The DenseMatrix to multiply
   * @return  New DenseMatrix were all entries are larger by "scalar" times
 */
-template<typename U, typename T>
-DenseMatrix<T> operator*(const U scalar, const DenseMatrix<T>& rhs);
+template<typename U, typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const U scalar, const DenseMatrix<T, Layout>& rhs);
 
 /**
   * @brief   Multiply a DenseMatrix by a scalar
@@ -248,20 +459,44 @@ DenseMatrix<T> operator*(const U scalar, const DenseMatrix<T>& rhs);
   * @param   lhs - The DenseMatrix to multiply
   * @return  New DenseMatrix were all entries are larger by "scalar" times
 */
-template<typename T, typename U>
-DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const U scalar);
+template<typename T, class Layout, typename U>
+DenseMatrix<T, Layout> operator*(const DenseMatrix<T, Layout>& lhs, const U scalar);
 
 /**
   * @brief   Multiply a DenseMatrix by a vector
   * @pre     Vector size must match DenseMatrix cols
   * @post    None
-  * @param   rhs - vector to multiply by 
+  * @param   rhs - vector to multiply by
   * @param   lhs - The DenseMatrix to multiply
   * @return  New vector
   * @throw   If vector size doesn't match DenseMatrix m_cols
 */
-template<typename T, typename U>
-vector<T> operator*(const DenseMatrix<T>& lhs, const vector<U>& rhs);
+template<typename T, class Layout, typename U>
+vector<T> operator*(const DenseMatrix<T, Layout>& lhs, const vector<U>& rhs);
+
+/**
+  * @brief   Multiply a LowerTriangle by a DenseMatrix with the blocked tpmm
+  * @pre     None
+  * @post    None
+  * @param   lhs - Square LowerTriangle left of *
+  * @param   rhs - Matrix right of *
+  * @return  New DenseMatrix that is lhs times rhs
+  * @throw   If lhs is not square or its cols don't match rhs rows
+*/
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const LowerTriangle<T>& lhs, const DenseMatrix<T, Layout>& rhs);
+
+/**
+  * @brief   Multiply an UpperTriangle by a DenseMatrix with the blocked tpmm
+  * @pre     None
+  * @post    None
+  * @param   lhs - Square UpperTriangle left of *
+  * @param   rhs - Matrix right of *
+  * @return  New DenseMatrix that is lhs times rhs
+  * @throw   If lhs is not square or its cols don't match rhs rows
+*/
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const UpperTriangle<T>& lhs, const DenseMatrix<T, Layout>& rhs);
 
 /**
   * @brief   Transposes the DenseMatrix, easier than multiplying by the ident DenseMatrix
@@ -270,8 +505,8 @@ vector<T> operator*(const DenseMatrix<T>& lhs, const vector<U>& rhs);
   * @param   source - The DenseMatrix to transpose, or "flip"
   * @return  New DenseMatrix were entries have been moved
 */
-template<typename T>
-DenseMatrix<T> transpose(const DenseMatrix<T>& source);
+template<typename T, class Layout>
+DenseMatrix<T, Layout> transpose(const DenseMatrix<T, Layout>& source);
 
 /**
   * @brief   Combines a DenseMatrix A and vector B and makes an augmented DenseMatrix
@@ -282,8 +517,8 @@ DenseMatrix<T> transpose(const DenseMatrix<T>& source);
   * @return  Matrix that is source and B combined where B is on the right side
   * @throw   If B size does not match source's row size
 */
-template<typename T>
-DenseMatrix<T> makeAug(const DenseMatrix<T>& source, const vector<T>& B);
+template<typename T, class Layout>
+DenseMatrix<T, Layout> makeAug(const DenseMatrix<T, Layout>& source, const vector<T>& B);
 
 /**
   * @brief   Displays the entries of the DenseMatrix
@@ -293,8 +528,8 @@ DenseMatrix<T> makeAug(const DenseMatrix<T>& source, const vector<T>& B);
   * @param   m - DenseMatrix object to read data in from
   * @return  The modified ostream object
 */
-template<typename T>
-std::ostream& operator<<(std::ostream& out, const DenseMatrix<T>& m);
+template<typename T, class Layout>
+std::ostream& operator<<(std::ostream& out, const DenseMatrix<T, Layout>& m);
 
 /**
   * @brief   Reads in the DenseMatrix data
@@ -304,10 +539,10 @@ std::ostream& operator<<(std::ostream& out, const DenseMatrix<T>& m);
   * @param   m - DenseMatrix object to store data in to
   * @return  The modified istream object
 */
-template<typename T>
-std::istream& operator>>(std::istream& in, DenseMatrix<T>& m);
+template<typename T, class Layout>
+std::istream& operator>>(std::istream& in, DenseMatrix<T, Layout>& m);
 
 
 #include "./dense.hpp"
 
-#endif
\ No newline at end of file
+#endif
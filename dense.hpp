@@ -8,7 +8,92 @@
 #include <cmath>
 
 template<typename T>
-DenseMatrix<T>::DenseMatrix(const int rows, const int cols)
+T& DenseColumn<T>::operator[](const int row) const
+{
+  if(row < 0 || row >= m_size)
+  {
+    std::cerr << "Out of bounds in column []" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  return m_data[row * m_stride];
+}
+
+template<typename T>
+DenseColumn<T>& DenseColumn<T>::operator=(const DenseColumn& source)
+{
+  return this->operator=<T>(source);
+}
+
+template<typename T>
+template<typename U>
+DenseColumn<T>& DenseColumn<T>::operator=(const DenseColumn<U>& source)
+{
+  if(source.getSize() != m_size)
+  {
+    std::cerr << "Column sizes do not match" << std::endl;
+    throw std::out_of_range("DIFFERENT SIZES");
+  }
+
+  for(int i = 0; i < m_size; i++)
+  {
+    m_data[i * m_stride] = source[i];
+  }
+
+  return *this;
+}
+
+template<typename T>
+DenseColumn<T>& DenseColumn<T>::operator=(const vector<std::remove_const_t<T>>& source)
+{
+  if(source.getSize() != m_size)
+  {
+    std::cerr << "Vector size does not match column size" << std::endl;
+    throw std::out_of_range("DIFFERENT SIZES");
+  }
+
+  const std::remove_const_t<T>* s = source.data();
+  for(int i = 0; i < m_size; i++)
+  {
+    m_data[i * m_stride] = s[i];
+  }
+
+  return *this;
+}
+
+template<typename T>
+DenseColumn<T>::operator vector<std::remove_const_t<T>>() const
+{
+  if(m_size == 0)
+  {
+    return vector<std::remove_const_t<T>>();
+  }
+
+  vector<std::remove_const_t<T>> column(m_size);
+  std::remove_const_t<T>* c = column.data();
+  for(int i = 0; i < m_size; i++)
+  {
+    c[i] = m_data[i * m_stride];
+  }
+
+  return column;
+}
+
+template<typename T, class Layout>
+DenseView<T, Layout> DenseView<T, Layout>::view(const int col, const int row,
+                                                const int cols, const int rows) const
+{
+  if(col < 0 || row < 0 || cols < 0 || rows < 0 || col + cols > m_cols || row + rows > m_rows)
+  {
+    std::cerr << "View does not fit" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  return DenseView(m_data + Layout::index(col, row, m_ld), rows, cols, m_ld);
+}
+
+template<typename T, class Layout>
+DenseMatrix<T, Layout>::DenseMatrix(const int rows, const int cols)
 {
   if(rows < 0 || cols < 0)
   {
@@ -17,17 +102,13 @@ DenseMatrix<T>::DenseMatrix(const int rows, const int cols)
   }
   m_rows = rows;
   m_cols = cols;
-  
-  ptr_to_data = vector<vector<T>>(m_cols);
+  m_ld = Layout::leading(rows, cols);
 
-  for(int i = 0; i < m_cols; i++)
-  {
-    ptr_to_data[i] = vector<T>(m_rows);
-  }
+  m_data = AlignedBuffer<T>(static_cast<std::ptrdiff_t>(m_rows) * m_cols);
 }
 
-template<typename T>
-void DenseMatrix<T>::setRow(const int r)
+template<typename T, class Layout>
+void DenseMatrix<T, Layout>::setRow(const int r)
 {
   if(r <= 0)
   {
@@ -35,11 +116,21 @@ void DenseMatrix<T>::setRow(const int r)
     throw std::out_of_range("SET ROW LESS THAN 1");
   }
 
-  m_rows = r;
+  DenseMatrix<T, Layout> temp(r, m_cols);
+  const int rows = (r < m_rows ? r : m_rows);
+  for(int j = 0; j < m_cols; j++)
+  {
+    for(int i = 0; i < rows; i++)
+    {
+      temp.at(j, i) = at(j, i);
+    }
+  }
+
+  *this = std::move(temp);
 }
 
-template<typename T>
-void DenseMatrix<T>::setCol(const int c)
+template<typename T, class Layout>
+void DenseMatrix<T, Layout>::setCol(const int c)
 {
   if(c <= 0)
   {
@@ -47,11 +138,21 @@ void DenseMatrix<T>::setCol(const int c)
     throw std::out_of_range("SET COL LESS THAN 1");
   }
 
-  m_cols = c;
+  DenseMatrix<T, Layout> temp(m_rows, c);
+  const int cols = (c < m_cols ? c : m_cols);
+  for(int j = 0; j < cols; j++)
+  {
+    for(int i = 0; i < m_rows; i++)
+    {
+      temp.at(j, i) = at(j, i);
+    }
+  }
+
+  *this = std::move(temp);
 }
 
-template<typename T>
-vector<T>& DenseMatrix<T>::operator[](const int index)
+template<typename T, class Layout>
+DenseColumn<T> DenseMatrix<T, Layout>::operator[](const int index)
 {
   if(index < 0 || index > (m_cols-1))
   {
@@ -59,11 +160,11 @@ vector<T>& DenseMatrix<T>::operator[](const int index)
     throw std::out_of_range("OUT OF BOUNDS");
   }
 
-  return ptr_to_data[index];
+  return DenseColumn<T>(&at(index, 0), m_rows, Layout::index(0, 1, m_ld));
 }
 
-template<typename T>
-const vector<T>& DenseMatrix<T>::operator[](const int index) const
+template<typename T, class Layout>
+DenseColumn<const T> DenseMatrix<T, Layout>::operator[](const int index) const
 {
   if(index < 0 || index > (m_cols-1))
   {
@@ -71,11 +172,11 @@ const vector<T>& DenseMatrix<T>::operator[](const int index) const
     throw std::out_of_range("OUT OF BOUNDS");
   }
 
-  return ptr_to_data[index];
+  return DenseColumn<const T>(&at(index, 0), m_rows, Layout::index(0, 1, m_ld));
 }
 
-template<typename T>
-T DenseMatrix<T>::operator()(const int col, const int row) const
+template<typename T, class Layout>
+T DenseMatrix<T, Layout>::operator()(const int col, const int row) const
 {
   if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
   {
@@ -83,15 +184,41 @@ T DenseMatrix<T>::operator()(const int col, const int row) const
     throw std::out_of_range("OUT OF BOUNDS");
   }
 
-  return ptr_to_data[col][row];
+  return at(col, row);
 }
 
-template<typename T>
-bool DenseMatrix<T>::isUpper() const
+template<typename T, class Layout>
+T& DenseMatrix<T, Layout>::operator()(const int col, const int row)
+{
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+  {
+    std::cerr << "Out of bounds ()" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  return at(col, row);
+}
+
+template<typename T, class Layout>
+DenseView<T, Layout> DenseMatrix<T, Layout>::view(const int col, const int row,
+                                                  const int cols, const int rows)
+{
+  return DenseView<T, Layout>(data(), m_rows, m_cols, m_ld).view(col, row, cols, rows);
+}
+
+template<typename T, class Layout>
+DenseView<const T, Layout> DenseMatrix<T, Layout>::view(const int col, const int row,
+                                                        const int cols, const int rows) const
+{
+  return DenseView<const T, Layout>(data(), m_rows, m_cols, m_ld).view(col, row, cols, rows);
+}
+
+template<typename T, class Layout>
+bool DenseMatrix<T, Layout>::isUpper() const
 {
   for(int i = 0; i < m_rows; i++)
   {
-    if(i < m_cols && ptr_to_data[i][i] == 0)
+    if(i < m_cols && at(i, i) == 0)
     {
       return false;
     }
@@ -99,9 +226,9 @@ bool DenseMatrix<T>::isUpper() const
 
   for(int i = 0; i < m_rows; i++)
   {
-    for(int j = 0; j < i; j++)
+    for(int j = 0; j < i && j < m_cols; j++)
     {
-      if(ptr_to_data[j][i] != 0)
+      if(at(j, i) != 0)
       {
         return false;
       }
@@ -111,12 +238,12 @@ bool DenseMatrix<T>::isUpper() const
   return true;
 }
 
-template<typename T>
-bool DenseMatrix<T>::isLower() const
+template<typename T, class Layout>
+bool DenseMatrix<T, Layout>::isLower() const
 {
   for(int i = 0; i < m_rows; i++)
   {
-    if(i < m_cols && ptr_to_data[i][i] == 0)
+    if(i < m_cols && at(i, i) == 0)
     {
       return false;
     }
@@ -126,7 +253,7 @@ bool DenseMatrix<T>::isLower() const
   {
     for(int j = i + 1; j < m_cols; j++)
     {
-      if(ptr_to_data[j][i] != 0)
+      if(at(j, i) != 0)
       {
         return false;
       }
@@ -136,14 +263,19 @@ bool DenseMatrix<T>::isLower() const
   return true;
 }
 
-template<typename T>
-bool DenseMatrix<T>::isSym() const
+template<typename T, class Layout>
+bool DenseMatrix<T, Layout>::isSym() const
 {
+  if(m_rows != m_cols)
+  {
+    return false;
+  }
+
   for(int i = 0; i < m_rows; i++)
   {
     for(int j = i; j < m_cols; j++)
     {
-      if(ptr_to_data[i][j] != ptr_to_data[j][i])
+      if(at(i, j) != at(j, i))
       {
         return false;
       }
@@ -153,14 +285,14 @@ bool DenseMatrix<T>::isSym() const
   return true;
 }
 
-template<typename T>
-bool DenseMatrix<T>::isTri() const
+template<typename T, class Layout>
+bool DenseMatrix<T, Layout>::isTri() const
 {
   for(int i = 0; i < m_rows; i++)
   {
     for(int j = 0; j < m_cols; j++)
     {
-      if(abs(j - i) > 1 && ptr_to_data[j][i] != 0)
+      if(abs(j - i) > 1 && at(j, i) != 0)
       {
         return false;
       }
@@ -170,8 +302,8 @@ bool DenseMatrix<T>::isTri() const
   return true;
 }
 
-template<typename T>
-UpperTriangle<T> DenseMatrix<T>::toUpper() const
+template<typename T, class Layout>
+UpperTriangle<T> DenseMatrix<T, Layout>::toUpper() const
 {
   UpperTriangle<T> UMatrix(m_rows, m_cols);
 
@@ -179,15 +311,15 @@ UpperTriangle<T> DenseMatrix<T>::toUpper() const
   {
     for(int j = i; j < m_cols; j++)
     {
-      UMatrix(j, i) = ptr_to_data[j][i];
+      UMatrix(j, i) = at(j, i);
     }
   }
 
   return UMatrix;
 }
 
-template<typename T>
-LowerTriangle<T> DenseMatrix<T>::toLower() const
+template<typename T, class Layout>
+LowerTriangle<T> DenseMatrix<T, Layout>::toLower() const
 {
   LowerTriangle<T> LMatrix(m_rows, m_cols);
 
@@ -195,15 +327,15 @@ LowerTriangle<T> DenseMatrix<T>::toLower() const
   {
     for(int j = 0; j <= i; j++)
     {
-      LMatrix(j, i) = ptr_to_data[j][i];
+      LMatrix(j, i) = at(j, i);
     }
   }
 
   return LMatrix;
 }
 
-template<typename T>
-SymMatrix<T> DenseMatrix<T>::toSym() const
+template<typename T, class Layout>
+SymMatrix<T> DenseMatrix<T, Layout>::toSym() const
 {
   SymMatrix<T> SMatrix(m_rows, m_cols);
 
@@ -211,15 +343,15 @@ SymMatrix<T> DenseMatrix<T>::toSym() const
   {
     for(int j =0; j <= i; j++)
     {
-      SMatrix(j, i) = ptr_to_data[j][i];
+      SMatrix(j, i) = at(j, i);
     }
   }
 
   return SMatrix;
 }
 
-template<typename T>
-TriDiag<T> DenseMatrix<T>::toTri() const
+template<typename T, class Layout>
+TriDiag<T> DenseMatrix<T, Layout>::toTri() const
 {
   TriDiag<T> TMatrix(m_rows, m_cols);
 
@@ -227,58 +359,97 @@ TriDiag<T> DenseMatrix<T>::toTri() const
   {
     if((i + 1) < m_cols)
     {
-      TMatrix(i + 1, i) = ptr_to_data[i + 1][i];
+      TMatrix(i + 1, i) = at(i + 1, i);
     }
-    TMatrix(i, i) = ptr_to_data[i][i];
+    TMatrix(i, i) = at(i, i);
     if((i + 1) < m_rows)
     {
-      TMatrix(i, i + 1) = ptr_to_data[i][i + 1];
+      TMatrix(i, i + 1) = at(i, i + 1);
     }
   }
 
   return TMatrix;
 }
 
-template<typename T>
-DenseMatrix<T> operator+(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs)
+template<typename T, class Layout>
+SparseMatrix<T> DenseMatrix<T, Layout>::toSparse(const bool symmetric) const
+{
+  int nonZeros = 0;
+  for(int i = 0; i < m_rows; i++)
+  {
+    const int last = symmetric ? i : m_cols - 1;
+    for(int j = 0; j <= last; j++)
+    {
+      if(at(j, i) != 0)
+      {
+        nonZeros++;
+      }
+    }
+  }
+
+  SparseMatrix<T> SMatrix(m_rows, m_cols, (nonZeros > 0 ? nonZeros : 1), symmetric);
+
+  for(int i = 0; i < m_rows; i++)
+  {
+    const int last = symmetric ? i : m_cols - 1;
+    for(int j = 0; j <= last; j++)
+    {
+      if(at(j, i) != 0)
+      {
+        SMatrix.append(j, at(j, i));
+      }
+    }
+    SMatrix.closeRow();
+  }
+
+  return SMatrix;
+}
+
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator+(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs)
 {
-  if(!(lhs.getRow() == rhs.getRow() && lhs.getCol() == lhs.getCol()))
+  if(!(lhs.getRow() == rhs.getRow() && lhs.getCol() == rhs.getCol()))
   {
     std::cerr << "Matrix's of different sizes cannot add" << std::endl;
     throw std::out_of_range("DIFFERENT SIZES"); // CHANGE THIS THROW TYPE
   }
 
-  DenseMatrix<T> temp(lhs.getRow(), lhs.getCol());
-
-  for(int i = 0; i < lhs.getCol(); i++)
+  // Same sizes and layout means the same leading dimension
+  DenseMatrix<T, Layout> temp(lhs.getRow(), lhs.getCol());
+  const T* a = lhs.data();
+  const T* b = rhs.data();
+  T* c = temp.data();
+  for(int i = 0; i < lhs.getRow() * lhs.getCol(); i++)
   {
-    temp[i] = lhs[i] + rhs[i];
+    c[i] = a[i] + b[i];
   }
 
   return temp;
 }
 
-template<typename T>
-DenseMatrix<T> operator-(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs)
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator-(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs)
 {
-  if(!(lhs.getRow() == rhs.getRow() && lhs.getCol() == lhs.getCol()))
+  if(!(lhs.getRow() == rhs.getRow() && lhs.getCol() == rhs.getCol()))
   {
     std::cerr << "Matrix's of different sizes cannot subtract" << std::endl;
     throw std::out_of_range("DIFFERENT SIZES"); // CHANGE THIS THROW TYPE
   }
 
-  DenseMatrix<T> temp(lhs.getRow(), lhs.getCol());
-
-  for(int i = 0; i < lhs.getCol(); i++)
+  DenseMatrix<T, Layout> temp(lhs.getRow(), lhs.getCol());
+  const T* a = lhs.data();
+  const T* b = rhs.data();
+  T* c = temp.data();
+  for(int i = 0; i < lhs.getRow() * lhs.getCol(); i++)
   {
-    temp[i] = lhs[i] - rhs[i];
+    c[i] = a[i] - b[i];
   }
 
   return temp;
 }
 
-template<typename T>
-DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs)
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const DenseMatrix<T, Layout>& lhs, const DenseMatrix<T, Layout>& rhs)
 {
   if(lhs.getCol() != rhs.getRow())
   {
@@ -287,48 +458,45 @@ DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const DenseMatrix<T>& rhs)
     throw std::out_of_range("MATRIX'S DIFFERENT COL AND ROWS"); // change the throw type
   }
 
-  DenseMatrix<T> temp(lhs.getRow(), rhs.getCol());
-  vector<T> rowVec(lhs.getCol());
+  const int m = lhs.getRow();
+  const int n = rhs.getCol();
+  const int inner = lhs.getCol();
+  DenseMatrix<T, Layout> temp(m, n);
+  const int lda = lhs.getLd();
+  const int ldb = rhs.getLd();
+  const int ldc = temp.getLd();
 
-  for(int i = 0; i < rhs.getCol(); i++)
-  {
-    for(int j = 0; j < lhs.getRow(); j++)
-    {
-      for(int k = 0; k < lhs.getCol(); k++)
-      {
-        rowVec[k] = lhs[k][j];
-      }
-      temp[i][j] = rowVec * rhs[i];
-    }
-  }
+  gemm(m, n, inner, static_cast<T>(1),
+       lhs.data(), Layout::rowStride(lda), Layout::colStride(lda),
+       rhs.data(), Layout::rowStride(ldb), Layout::colStride(ldb),
+       static_cast<T>(0), temp.data(), Layout::rowStride(ldc), Layout::colStride(ldc));
 
   return temp;
 }
 
-template<typename U, typename T>
-DenseMatrix<T> operator*(const U scalar, const DenseMatrix<T>& rhs)
+template<typename U, typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const U scalar, const DenseMatrix<T, Layout>& rhs)
 {
-  DenseMatrix<T> temp(rhs.getRow(), rhs.getCol());
+  DenseMatrix<T, Layout> temp(rhs.getRow(), rhs.getCol());
+  const T* a = rhs.data();
+  T* c = temp.data();
 
-  for(int i = 0; i < temp.getRow(); i++)
+  for(int i = 0; i < rhs.getRow() * rhs.getCol(); i++)
   {
-    for(int j = 0; j < temp.getCol(); j++)
-    {
-      temp[i][j] = scalar * rhs[i][j];
-    }
+    c[i] = scalar * a[i];
   }
-  
+
   return temp;
 }
 
-template<typename T, typename U>
-DenseMatrix<T> operator*(const DenseMatrix<T>& lhs, const U scalar)
+template<typename T, class Layout, typename U>
+DenseMatrix<T, Layout> operator*(const DenseMatrix<T, Layout>& lhs, const U scalar)
 {
   return scalar * lhs;
 }
 
-template<typename T, typename U>
-vector<T> operator*(const DenseMatrix<T>& lhs, const vector<U>& rhs)
+template<typename T, class Layout, typename U>
+vector<T> operator*(const DenseMatrix<T, Layout>& lhs, const vector<U>& rhs)
 {
   if(rhs.getSize() != lhs.getCol())
   {
@@ -336,40 +504,134 @@ vector<T> operator*(const DenseMatrix<T>& lhs, const vector<U>& rhs)
     throw std::out_of_range("MISMATCHED VECTOR SIZE AND MATRIX ROW SIZE");
   }
 
-  vector<T> temp(rhs.getSize());
-  T sum = 0;
+  vector<T> temp(lhs.getRow());
+  const T* a = lhs.data();
+  const U* x = rhs.data();
+  T* y = temp.data();
+  const int ld = lhs.getLd();
+
+  if constexpr(std::is_same<Layout, RowMajor>::value)
+  {
+    for(int i = 0; i < lhs.getRow(); i++)
+    {
+      const T* ai = a + i * ld;
+      T sum = 0;
+      for(int j = 0; j < lhs.getCol(); j++)
+      {
+        sum += ai[j] * x[j];
+      }
+      y[i] = sum;
+    }
+  }
+  else
+  {
+    for(int j = 0; j < lhs.getCol(); j++)
+    {
+      const T* aj = a + j * ld;
+      const T xj = x[j];
+      for(int i = 0; i < lhs.getRow(); i++)
+      {
+        y[i] += aj[i] * xj;
+      }
+    }
+  }
+
+  return temp;
+}
+
+/**
+  * @brief   A B for a packed triangle A, B is copied column major so tpmm
+              can work on it in place
+  * @pre     ap holds n (n + 1) / 2 values in the layout of uplo
+  * @post    None
+  * @param   uplo - LOWER_TRIANGLE or UPPER_TRIANGLE
+  * @param   ap - Packed A
+  * @param   n - Order of A, rows of rhs
+  * @param   rhs - Matrix "B"
+  * @return  New DenseMatrix that is A B
+*/
+template<typename T, class Layout>
+DenseMatrix<T, Layout> triangleTimes(const int uplo, const T* ap, const int n,
+                                     const DenseMatrix<T, Layout>& rhs)
+{
+  const int k = rhs.getCol();
+  DenseMatrix<T> work(n, k);
+  T* w = work.data();
+  const int ld = work.getLd();
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      w[col * ld + row] = rhs(col, row);
+    }
+  }
+
+  tpmm(uplo, NO_TRANSPOSE, n, ap, k, w, ld);
 
-  for(int i = 0; i < lhs.getCol(); i++)
+  DenseMatrix<T, Layout> temp(n, k);
+  for(int col = 0; col < k; col++)
   {
-    for(int j = 0; j < lhs.getRow(); j++)
+    for(int row = 0; row < n; row++)
     {
-      sum += lhs[j][i] * rhs[j];
+      temp(col, row) = w[col * ld + row];
     }
-    temp[i] = sum;
-    sum = 0;
   }
 
   return temp;
 }
 
-template<typename T>
-DenseMatrix<T> transpose(const DenseMatrix<T>& source)
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const LowerTriangle<T>& lhs, const DenseMatrix<T, Layout>& rhs)
+{
+  if(lhs.getRow() != lhs.getCol() || lhs.getCol() != rhs.getRow())
+  {
+    std::cerr << "Lower col size does not match matrix rows" << std::endl;
+    throw std::out_of_range("MISMATCHED SIZES");
+  }
+
+  return triangleTimes(LOWER_TRIANGLE, lhs.column(0), lhs.getRow(), rhs);
+}
+
+template<typename T, class Layout>
+DenseMatrix<T, Layout> operator*(const UpperTriangle<T>& lhs, const DenseMatrix<T, Layout>& rhs)
 {
-  DenseMatrix<T> temp(source.getCol(), source.getRow());
+  if(lhs.getRow() != lhs.getCol() || lhs.getCol() != rhs.getRow())
+  {
+    std::cerr << "Upper col size does not match matrix rows" << std::endl;
+    throw std::out_of_range("MISMATCHED SIZES");
+  }
 
-  for(int i = 0; i < source.getCol(); i++)
+  return triangleTimes(UPPER_TRIANGLE, lhs.column(0), lhs.getRow(), rhs);
+}
+
+template<typename T, class Layout>
+DenseMatrix<T, Layout> transpose(const DenseMatrix<T, Layout>& source)
+{
+  DenseMatrix<T, Layout> temp(source.getCol(), source.getRow());
+  const DenseView<const T, Layout> from = source.view(0, 0, source.getCol(), source.getRow());
+  const DenseView<T, Layout> to = temp.view(0, 0, temp.getCol(), temp.getRow());
+
+  // Blocks keep both the reads and the writes inside a few cache lines
+  const int BLOCK = 32;
+  for(int ib = 0; ib < source.getCol(); ib += BLOCK)
   {
-    for(int j = 0; j < source.getRow(); j++)
+    for(int jb = 0; jb < source.getRow(); jb += BLOCK)
     {
-      temp[j][i] = source(i, j);
+      for(int i = ib; i < ib + BLOCK && i < source.getCol(); i++)
+      {
+        for(int j = jb; j < jb + BLOCK && j < source.getRow(); j++)
+        {
+          to(j, i) = from(i, j);
+        }
+      }
     }
   }
 
   return temp;
 }
 
-template<typename T>
-DenseMatrix<T> makeAug(const DenseMatrix<T>& source, const vector<T>& B)
+template<typename T, class Layout>
+DenseMatrix<T, Layout> makeAug(const DenseMatrix<T, Layout>& source, const vector<T>& B)
 {
 
   if(source.getRow() != B.getSize())
@@ -379,10 +641,15 @@ DenseMatrix<T> makeAug(const DenseMatrix<T>& source, const vector<T>& B)
     throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE");
   }
 
-  DenseMatrix<T> temp(source.getRow(), source.getCol()+1);
+  DenseMatrix<T, Layout> temp(source.getRow(), source.getCol()+1);
+  const DenseView<const T, Layout> from = source.view(0, 0, source.getCol(), source.getRow());
+  const DenseView<T, Layout> to = temp.view(0, 0, temp.getCol(), temp.getRow());
   for(int i = 0; i < source.getCol(); i++)
   {
-    temp[i] = source[i];
+    for(int j = 0; j < source.getRow(); j++)
+    {
+      to(i, j) = from(i, j);
+    }
   }
 
   temp[temp.getCol()-1] = B;
@@ -390,14 +657,14 @@ DenseMatrix<T> makeAug(const DenseMatrix<T>& source, const vector<T>& B)
   return temp;
 }
 
-template<typename T>
-std::ostream& operator<<(std::ostream& out, const DenseMatrix<T>& m)
+template<typename T, class Layout>
+std::ostream& operator<<(std::ostream& out, const DenseMatrix<T, Layout>& m)
 {
   for(int i = 0; i < m.getRow(); i++)
   {
     for(int j = 0; j < m.getCol(); j++)
     {
-      out << m[j][i] << " ";
+      out << m(j, i) << " ";
     }
     out << std::endl;
   }
@@ -405,14 +672,14 @@ std::ostream& operator<<(std::ostream& out, const DenseMatrix<T>& m)
   return out;
 }
 
-template<typename T>
-std::istream& operator>>(std::istream& in, DenseMatrix<T>& m)
+template<typename T, class Layout>
+std::istream& operator>>(std::istream& in, DenseMatrix<T, Layout>& m)
 {
-  for(int i = 0; i < m.getCol(); i++)
+  for(int i = 0; i < m.getRow(); i++)
   {
-    for(int j = 0; j < m.getRow(); j++)
+    for(int j = 0; j < m.getCol(); j++)
     {
-      if(!(in >> m[j][i]))
+      if(!(in >> m(j, i)))
       {
         throw std::runtime_error("Not enough data in file to fill DenseMatrix");
       }
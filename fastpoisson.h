@@ -0,0 +1,107 @@
+/**
+  * @file   fastpoisson.h
+  * @author Dylan Warren, Section A
+  * @brief  The fast Poisson class is a "functor" class, it solves the five
+            point Poisson system directly with sine transforms.
+*/
+/**
+  * @class  FastPoissonSolver
+  * @brief  FastPoissonSolver uses that sin(pi j x / N) sin(pi k y / N) are the
+  *         eigenvectors of the five point operator. A 2D DST-I takes B to
+  *         that basis, each coefficient is divided by its eigenvalue and a
+  *         second 2D DST-I takes it back, O(N^2 log N) for the whole mesh.
+*/
+#ifndef FASTPOISSON_H
+#define FASTPOISSON_H
+
+#include <memory>
+#include "./partial.h"
+#include "./poisson.h"
+#include "./fft.h"
+
+template<class T>
+class FastPoissonSolver
+{
+  private:
+    T m_lower;
+    T m_upper;
+    // Kept between solves, rebuilt when N changes
+    std::unique_ptr<SineTransform<T>> m_transform;
+    /**
+      * @brief   Sine transforms every grid line of x, two at a time
+      * @pre     x must hold line * line values
+      * @post    Each line of x holds its transform
+      * @param   x - Grid, line after line
+      * @param   line - Points on one grid line, N-1
+      * @return  None
+    */
+    void transformLines(T* x, const int line);
+    /**
+      * @brief   Transposes a square grid in cache sized blocks
+      * @pre     from and to must both hold line * line values
+      * @post    to(j, k) = from(k, j)
+      * @param   from - Grid to read
+      * @param   to - Grid to write
+      * @param   line - Points on one grid line, N-1
+      * @return  None
+    */
+    static void transpose(const T* from, T* to, const int line);
+  public:
+    /**
+      * @brief   Sets the square the mesh covers
+      * @pre     upper must be greater than lower
+      * @post    Creates a solver
+      * @param   lower - Lower bound
+      * @param   upper - Upper bound
+      * @return  None
+      * @throw   If upper is lower than lower
+    */
+    FastPoissonSolver(const T lower, const T upper);
+    /**
+      * @brief   Solves Poisson's equation, same arguments as PartialDiff
+      * @pre     All function pointers must be passed in.
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced function; f(x, y)
+      * @param   partitions - Our N.
+      * @return  The (N-1)^2 x vector, numbered like PartialDiff
+      * @throw   If any function ptr is missing or partitions is less than 2
+    */
+    vector<T> operator()(const FunctPtr UpperBound, const FunctPtr LowerBound,
+          const FunctPtr LeftBound, const FunctPtr RightBound, const ForcedFunct Forced,
+          const int partitions);
+    /**
+      * @brief   Solves Poisson's equation from batch functions, same arguments
+                  as PartialDiff
+      * @pre     All functions must be passed in.
+      * @post    None
+      * @param   UpperBound - Edge u(UPPER, y) at count y values
+      * @param   LowerBound - Edge u(LOWER, y) at count y values
+      * @param   LeftBound - Edge u(x, UPPER) at count x values
+      * @param   RightBound - Edge u(x, LOWER) at count x values
+      * @param   Forced - f(x, y) at count mesh points
+      * @param   partitions - Our N.
+      * @return  The (N-1)^2 x vector, numbered like PartialDiff
+      * @throw   If any function is missing or partitions is less than 2
+    */
+    vector<T> operator()(const BoundaryBatch& UpperBound, const BoundaryBatch& LowerBound,
+          const BoundaryBatch& LeftBound, const BoundaryBatch& RightBound,
+          const ForcedBatch& Forced, const int partitions);
+    /**
+      * @brief   Solves A x = B for the five point operator A
+      * @pre     B must come from PartialDiff::makeRHS with the same N as A
+      * @post    None
+      * @param   A - The operator of the mesh
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If B does not match the size of A
+    */
+    vector<T> operator()(const PoissonOperator<T>& A, const vector<T>& B);
+};
+
+#include "./fastpoisson.hpp"
+
+#endif
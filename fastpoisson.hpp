@@ -0,0 +1,130 @@
+/**
+  * @file   fastpoisson.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the () operators of FastPoissonSolver
+*/
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+template<typename T>
+FastPoissonSolver<T>::FastPoissonSolver(const T lower, const T upper)
+{
+  if(upper < lower)
+  {
+    throw std::out_of_range("Invalid bounds, upper is less than lower");
+  }
+
+  m_lower = lower;
+  m_upper = upper;
+}
+
+template<typename T>
+vector<T> FastPoissonSolver<T>::operator()(const FunctPtr xUpper, const FunctPtr xLower,
+                    const FunctPtr yUpper, const FunctPtr yLower, const ForcedFunct Forced,
+                    const int partitions)
+{
+  const PartialDiff<T> PDE(m_lower, m_upper);
+  return this->operator()(PDE.makeOperator(partitions),
+                          PDE.makeRHS(xUpper, xLower, yUpper, yLower, Forced, partitions));
+}
+
+template<typename T>
+vector<T> FastPoissonSolver<T>::operator()(const BoundaryBatch& xUpper,
+                    const BoundaryBatch& xLower, const BoundaryBatch& yUpper,
+                    const BoundaryBatch& yLower, const ForcedBatch& Forced,
+                    const int partitions)
+{
+  const PartialDiff<T> PDE(m_lower, m_upper);
+  return this->operator()(PDE.makeOperator(partitions),
+                          PDE.makeRHS(xUpper, xLower, yUpper, yLower, Forced, partitions));
+}
+
+template<typename T>
+vector<T> FastPoissonSolver<T>::operator()(const PoissonOperator<T>& A,
+                                           const vector<T>& B)
+{
+  if(A.getRow() != B.getSize())
+  {
+    std::cerr << "Fast Poisson operator size does not match vector size" << std::endl;
+    throw std::out_of_range("OPERATOR SIZE DOES NOT MATCH VECTOR SIZE; FAST POISSON");
+  }
+
+  const int N = A.getPartitions();
+  const int line = N - 1;
+  if(!m_transform || m_transform->getSize() != line)
+  {
+    m_transform.reset(new SineTransform<T>(line));
+  }
+
+  vector<T> x(B);
+  vector<T> work(B.getSize());
+
+  // S B S along x then y, transposing so every transform runs down a row
+  transformLines(x.data(), line);
+  transpose(x.data(), work.data(), line);
+  transformLines(work.data(), line);
+
+  // A = I - 1/4 (neighbours) has eigenvalues 1 - (cos(pi j / N) + cos(pi k / N)) / 2
+  // = sin^2(pi j / 2N) + sin^2(pi k / 2N), which keeps the small ones accurate.
+  // S S = N / 2 I, so (2 / N)^2 undoes both transforms.
+  const T PI = static_cast<T>(3.14159265358979323846264338327950288L);
+  vector<T> half(line);
+  for(int j = 0; j < line; j++)
+  {
+    const T s = std::sin(PI * static_cast<T>(j + 1) / static_cast<T>(2 * N));
+    half[j] = s * s;
+  }
+  const T scale = static_cast<T>(4) / (static_cast<T>(N) * static_cast<T>(N));
+  T* w = work.data();
+  const T* h = half.data();
+  for(int k = 0; k < line; k++)
+  {
+    T* wk = w + k * line;
+    for(int j = 0; j < line; j++)
+    {
+      wk[j] *= scale / (h[j] + h[k]);
+    }
+  }
+
+  transformLines(work.data(), line);
+  transpose(work.data(), x.data(), line);
+  transformLines(x.data(), line);
+
+  return x;
+}
+
+template<typename T>
+void FastPoissonSolver<T>::transformLines(T* x, const int line)
+{
+  int k = 0;
+  for(; k + 1 < line; k += 2)
+  {
+    m_transform->apply(x + k * line, x + (k + 1) * line);
+  }
+  if(k < line)
+  {
+    m_transform->apply(x + k * line, nullptr);
+  }
+}
+
+template<typename T>
+void FastPoissonSolver<T>::transpose(const T* from, T* to, const int line)
+{
+  const int BLOCK = 32;
+  for(int kb = 0; kb < line; kb += BLOCK)
+  {
+    const int kEnd = (kb + BLOCK < line ? kb + BLOCK : line);
+    for(int jb = 0; jb < line; jb += BLOCK)
+    {
+      const int jEnd = (jb + BLOCK < line ? jb + BLOCK : line);
+      for(int k = kb; k < kEnd; k++)
+      {
+        for(int j = jb; j < jEnd; j++)
+        {
+          to[j * line + k] = from[k * line + j];
+        }
+      }
+    }
+  }
+}
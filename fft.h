@@ -0,0 +1,116 @@
+/**
+  * @file   fft.h
+  * @author Dylan Warren, Section A
+  * @brief  Fast Fourier and sine transforms for the fast Poisson solver.
+*/
+/**
+  * @class  FFT
+  * @brief  FFT is a plan for complex transforms of one length. Lengths made of
+  *         small primes run as mixed radix Stockham stages, any other length
+  *         goes through Bluestein's chirp with a power of two transform.
+  *         Every twiddle factor is computed once, when the plan is made.
+*/
+/**
+  * @class  SineTransform
+  * @brief  SineTransform is a plan for the DST-I of length N-1,
+  *         S[k] = sum over n of x[n] sin(pi n k / N), done as the FFT of the
+  *         odd extension. Two lines are packed into one complex transform.
+*/
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <complex>
+#include <memory>
+#include "./vector.h"
+
+template<class T>
+class FFT
+{
+  private:
+    int m_size;
+    vector<int> m_radices;
+    vector<int> m_twiddleStart;
+    vector<std::complex<T>> m_twiddles;
+    vector<std::complex<T>> m_work;
+    bool m_bluestein;
+    std::unique_ptr<FFT<T>> m_inner;
+    vector<std::complex<T>> m_chirp;
+    vector<std::complex<T>> m_chirpFFT;
+    vector<std::complex<T>> m_padded;
+    /**
+      * @brief   Runs the Stockham stages on data
+      * @pre     The plan is not a Bluestein plan
+      * @post    data holds its transform
+      * @param   data - m_size values
+      * @return  None
+    */
+    void stockham(std::complex<T>* data);
+  public:
+    /**
+      * @brief   Plans transforms of length n
+      * @pre     n must be greater than zero
+      * @post    Creates a plan with every twiddle factor cached
+      * @param   n - Length of the transform
+      * @return  None
+      * @throw   If n is less than 1
+    */
+    FFT(const int n);
+    FFT(const FFT&) = delete;
+    FFT& operator=(const FFT&) = delete;
+    /**
+      * @brief   Gets the planned length
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getSize() const { return m_size; }
+    /**
+      * @brief   In place forward transform, X[k] = sum of x[n] e^(-2 pi i n k / size)
+      * @pre     data must hold getSize() values
+      * @post    data holds its transform
+      * @param   data - Values to transform
+      * @return  None
+    */
+    void forward(std::complex<T>* data);
+};
+
+template<class T>
+class SineTransform
+{
+  private:
+    int m_size;
+    FFT<T> m_fft;
+    vector<std::complex<T>> m_buffer;
+  public:
+    /**
+      * @brief   Plans DST-I transforms of length size
+      * @pre     size must be greater than zero
+      * @post    Creates a plan, its FFT has length 2 (size + 1)
+      * @param   size - Length of the lines, N-1
+      * @return  None
+      * @throw   If size is less than 1
+    */
+    SineTransform(const int size);
+    /**
+      * @brief   Gets the planned length
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getSize() const { return m_size; }
+    /**
+      * @brief   Transforms one or two lines in place, applying it twice
+                  scales a line by (size + 1) / 2
+      * @pre     Both lines must hold getSize() values
+      * @post    The lines hold their sine transforms
+      * @param   first - Line to transform
+      * @param   second - Second line to transform, or nullptr
+      * @return  None
+    */
+    void apply(T* first, T* second);
+};
+
+#include "./fft.hpp"
+
+#endif
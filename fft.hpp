@@ -0,0 +1,306 @@
+/**
+  * @file   fft.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the FFT and SineTransform plans
+*/
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+template<typename T>
+FFT<T>::FFT(const int n)
+{
+  if(n < 1)
+  {
+    std::cerr << "Transform length must be at least 1" << std::endl;
+    throw std::out_of_range("BAD LENGTH; FFT");
+  }
+
+  m_size = n;
+  m_bluestein = false;
+  const T PI = static_cast<T>(3.14159265358979323846264338327950288L);
+
+  // Radix 4 first then small primes, anything over 7 left means Bluestein
+  int stages[32];
+  int count = 0;
+  int rest = n;
+  while(rest % 4 == 0)
+  {
+    stages[count++] = 4;
+    rest /= 4;
+  }
+  for(int p = 2; p <= 7; p++)
+  {
+    while(rest % p == 0)
+    {
+      stages[count++] = p;
+      rest /= p;
+    }
+  }
+
+  if(rest != 1)
+  {
+    // Bluestein, x[n] e^(-2 pi i n k / N) = w[k] (w*[k - n] (w[n] x[n])) with
+    // w[n] = e^(-pi i n^2 / N), a convolution done with power of two FFTs
+    m_bluestein = true;
+    int padded = 1;
+    while(padded < 2 * n - 1)
+    {
+      padded *= 2;
+    }
+    m_inner.reset(new FFT<T>(padded));
+    m_chirp = vector<std::complex<T>>(n);
+    m_chirpFFT = vector<std::complex<T>>(padded);
+    m_padded = vector<std::complex<T>>(padded);
+    for(int k = 0; k < n; k++)
+    {
+      // k^2 mod 2N keeps the angle small for long transforms
+      const long long square = (static_cast<long long>(k) * k) % (2LL * n);
+      const T angle = PI * static_cast<T>(square) / static_cast<T>(n);
+      m_chirp[k] = std::complex<T>(std::cos(angle), -std::sin(angle));
+    }
+    std::complex<T>* b = m_chirpFFT.data();
+    b[0] = std::conj(m_chirp[0]);
+    for(int k = 1; k < n; k++)
+    {
+      b[k] = std::conj(m_chirp[k]);
+      b[padded - k] = b[k];
+    }
+    m_inner->forward(b);
+    return;
+  }
+
+  if(count == 0)
+  {
+    return;
+  }
+
+  // Stage s splits length L into radix r pieces of length m = L / r and
+  // needs w^(p k), w = e^(-2 pi i / L), for p < m and k < r
+  m_radices = vector<int>(count);
+  m_twiddleStart = vector<int>(count);
+  int total = 0;
+  int length = n;
+  for(int s = 0; s < count; s++)
+  {
+    m_radices[s] = stages[s];
+    m_twiddleStart[s] = total;
+    total += length;
+    length /= stages[s];
+  }
+  m_twiddles = vector<std::complex<T>>(total);
+  m_work = vector<std::complex<T>>(n);
+
+  length = n;
+  for(int s = 0; s < count; s++)
+  {
+    const int r = m_radices[s];
+    const int m = length / r;
+    std::complex<T>* w = m_twiddles.data() + m_twiddleStart[s];
+    for(int p = 0; p < m; p++)
+    {
+      for(int k = 0; k < r; k++)
+      {
+        const T angle = 2 * PI * static_cast<T>(p * k) / static_cast<T>(length);
+        w[p * r + k] = std::complex<T>(std::cos(angle), -std::sin(angle));
+      }
+    }
+    length = m;
+  }
+}
+
+template<typename T>
+void FFT<T>::forward(std::complex<T>* data)
+{
+  if(!m_bluestein)
+  {
+    stockham(data);
+    return;
+  }
+
+  const int n = m_size;
+  const int padded = m_inner->getSize();
+  std::complex<T>* a = m_padded.data();
+  const std::complex<T>* w = m_chirp.data();
+  const std::complex<T>* b = m_chirpFFT.data();
+  for(int k = 0; k < n; k++)
+  {
+    a[k] = data[k] * w[k];
+  }
+  for(int k = n; k < padded; k++)
+  {
+    a[k] = 0;
+  }
+
+  // Inverse transform as conj(FFT(conj(z))) / padded
+  m_inner->forward(a);
+  for(int k = 0; k < padded; k++)
+  {
+    a[k] = std::conj(a[k] * b[k]);
+  }
+  m_inner->forward(a);
+  const T scale = static_cast<T>(1) / static_cast<T>(padded);
+  for(int k = 0; k < n; k++)
+  {
+    data[k] = std::conj(a[k]) * w[k] * scale;
+  }
+}
+
+template<typename T>
+void FFT<T>::stockham(std::complex<T>* data)
+{
+  const int count = m_radices.getSize();
+  if(count == 0)
+  {
+    return;
+  }
+
+  // Decimation in frequency, x[q + s (p + j m)] feeds y[q + s (r p + k)] so the
+  // output comes out in order and the s values of q run unit stride
+  std::complex<T>* x = data;
+  std::complex<T>* y = m_work.data();
+  int length = m_size;
+  int s = 1;
+  for(int stage = 0; stage < count; stage++)
+  {
+    const int r = m_radices[stage];
+    const int m = length / r;
+    const std::complex<T>* w = m_twiddles.data() + m_twiddleStart[stage];
+
+    if(r == 2)
+    {
+      for(int p = 0; p < m; p++)
+      {
+        const std::complex<T> w1 = w[p * 2 + 1];
+        const std::complex<T>* x0 = x + s * p;
+        const std::complex<T>* x1 = x + s * (p + m);
+        std::complex<T>* y0 = y + s * (2 * p);
+        std::complex<T>* y1 = y0 + s;
+        for(int q = 0; q < s; q++)
+        {
+          const std::complex<T> a = x0[q];
+          const std::complex<T> b = x1[q];
+          y0[q] = a + b;
+          y1[q] = (a - b) * w1;
+        }
+      }
+    }
+    else if(r == 4)
+    {
+      for(int p = 0; p < m; p++)
+      {
+        const std::complex<T> w1 = w[p * 4 + 1];
+        const std::complex<T> w2 = w[p * 4 + 2];
+        const std::complex<T> w3 = w[p * 4 + 3];
+        const std::complex<T>* x0 = x + s * p;
+        const std::complex<T>* x1 = x + s * (p + m);
+        const std::complex<T>* x2 = x + s * (p + 2 * m);
+        const std::complex<T>* x3 = x + s * (p + 3 * m);
+        std::complex<T>* y0 = y + s * (4 * p);
+        for(int q = 0; q < s; q++)
+        {
+          const std::complex<T> a0 = x0[q] + x2[q];
+          const std::complex<T> a1 = x0[q] - x2[q];
+          const std::complex<T> b0 = x1[q] + x3[q];
+          const std::complex<T> d = x1[q] - x3[q];
+          // -i (x1 - x3)
+          const std::complex<T> b1(d.imag(), -d.real());
+          y0[q] = a0 + b0;
+          y0[q + s] = (a1 + b1) * w1;
+          y0[q + 2 * s] = (a0 - b0) * w2;
+          y0[q + 3 * s] = (a1 - b1) * w3;
+        }
+      }
+    }
+    else
+    {
+      // Small prime, a direct DFT of the r inputs
+      const T PI = static_cast<T>(3.14159265358979323846264338327950288L);
+      std::complex<T> root[7];
+      for(int j = 0; j < r; j++)
+      {
+        const T angle = 2 * PI * static_cast<T>(j) / static_cast<T>(r);
+        root[j] = std::complex<T>(std::cos(angle), -std::sin(angle));
+      }
+      std::complex<T> a[7];
+      for(int p = 0; p < m; p++)
+      {
+        for(int q = 0; q < s; q++)
+        {
+          for(int j = 0; j < r; j++)
+          {
+            a[j] = x[q + s * (p + j * m)];
+          }
+          for(int k = 0; k < r; k++)
+          {
+            std::complex<T> sum = a[0];
+            for(int j = 1; j < r; j++)
+            {
+              sum += a[j] * root[(j * k) % r];
+            }
+            y[q + s * (r * p + k)] = sum * w[p * r + k];
+          }
+        }
+      }
+    }
+
+    std::complex<T>* swap = x;
+    x = y;
+    y = swap;
+    length = m;
+    s *= r;
+  }
+
+  if(x != data)
+  {
+    for(int i = 0; i < m_size; i++)
+    {
+      data[i] = x[i];
+    }
+  }
+}
+
+template<typename T>
+SineTransform<T>::SineTransform(const int size) : m_fft(2 * (size + 1))
+{
+  if(size < 1)
+  {
+    std::cerr << "Sine transform length must be at least 1" << std::endl;
+    throw std::out_of_range("BAD LENGTH; DST");
+  }
+
+  m_size = size;
+  m_buffer = vector<std::complex<T>>(2 * (size + 1));
+}
+
+template<typename T>
+void SineTransform<T>::apply(T* first, T* second)
+{
+  // The odd extension y = [0, x, 0, -x reversed] of a real line has the
+  // transform Y[k] = -2 i S[k], so with z = y1 + i y2, Z = -2 i S1 + 2 S2
+  const int N = m_size + 1;
+  std::complex<T>* z = m_buffer.data();
+  z[0] = 0;
+  z[N] = 0;
+  for(int n = 1; n < N; n++)
+  {
+    const T b = (second != nullptr ? second[n - 1] : static_cast<T>(0));
+    z[n] = std::complex<T>(first[n - 1], b);
+    z[2 * N - n] = -z[n];
+  }
+
+  m_fft.forward(z);
+
+  const T half = static_cast<T>(0.5);
+  for(int k = 1; k < N; k++)
+  {
+    first[k - 1] = -half * z[k].imag();
+  }
+  if(second != nullptr)
+  {
+    for(int k = 1; k < N; k++)
+    {
+      second[k - 1] = half * z[k].real();
+    }
+  }
+}
@@ -0,0 +1,146 @@
+/**
+  * @file   ldlt.h
+  * @author Dylan Warren, Section A
+  * @brief  The LDL^T factorization of a symmetric, possibly indefinite
+            SymMatrix, P A P^T = L D L^T, kept so it can solve for any
+            number of right hand sides.
+*/
+/**
+  * @class  LDLTFactorization
+  * @brief  LDLTFactorization uses Bunch-Kaufman pivoting, D is made of 1 by 1
+  *         and 2 by 2 blocks and L has a unit diagonal, so no square roots
+  *         are taken. It is blocked like LUFactorization: a panel of BLOCK
+  *         columns is factored left-looking into a work copy W = L D, then
+  *         the trailing lower triangle is updated with gemm against W. Row
+  *         interchanges are applied to all of L, so one permutation vector
+  *         describes P.
+*/
+#ifndef LDLT_H
+#define LDLT_H
+
+#include <stdexcept>
+#include "./symmetric.h"
+#include "./dense.h"
+#include "./blas.h"
+#include "./threadpool.h"
+
+/** Eigenvalue signs of A, read off the blocks of D (Sylvester's law) */
+struct Inertia
+{
+  int positive;
+  int negative;
+  int zero;
+};
+
+template<class T>
+class LDLTFactorization
+{
+  private:
+    DenseMatrix<T> m_ldl;
+    vector<int> m_perm;
+    // 1 for a 1 by 1 block, 2 on the first col of a 2 by 2 block, 0 on its second
+    vector<int> m_block;
+    bool m_singular;
+    ThreadPool* m_pool;
+    /**
+      * @brief   Factors m_ldl in place, filling m_perm and m_block
+      * @pre     The lower half of m_ldl holds A
+      * @post    m_ldl holds L below the diagonal (unit diagonal not stored)
+                  and D on the diagonal and, for 2 by 2 blocks, just below it
+      * @return  None
+    */
+    void factor();
+    /**
+      * @brief   Solves L D L^T x = y in place for count right hand sides
+      * @pre     x holds y, already permuted, one column every ldx values
+      * @post    x holds the solutions
+      * @param   x - First right hand side
+      * @param   count - Right hand sides
+      * @param   ldx - Distance between right hand sides
+      * @return  None
+    */
+    void substitute(T* x, const int count, const int ldx) const;
+  public:
+    /** Columns in one panel */
+    static const int BLOCK = 64;
+    /**
+      * @brief   Copies and factors source. A column that is entirely 0 when
+                  its turn comes leaves a 0 in D, the factorization carries
+                  on and only solving is refused.
+      * @pre     source must be square
+      * @post    The factorization is ready to solve with
+      * @param   source - Matrix "A"
+      * @param   pool - Threads to update the trailing matrix with
+      * @return  None
+      * @throw   If source is not square
+    */
+    LDLTFactorization(const SymMatrix<T>& source, ThreadPool& pool = ThreadPool::global());
+    /**
+      * @brief   Gets the order of A
+      * @pre     None
+      * @post    None
+      * @return  Rows of A
+    */
+    int getSize() const { return m_ldl.getRow(); }
+    /**
+      * @brief   Gets L and D packed together
+      * @pre     None
+      * @post    None
+      * @return  m_ldl, only its lower half is meaningful
+    */
+    const DenseMatrix<T>& getLDL() const { return m_ldl; }
+    /**
+      * @brief   Gets the interchanges, row i of P A P^T is row
+                  getPermutation()[i] of A
+      * @pre     None
+      * @post    None
+      * @return  m_perm
+    */
+    const vector<int>& getPermutation() const { return m_perm; }
+    /**
+      * @brief   Gets the block of D starting at each col
+      * @pre     None
+      * @post    None
+      * @return  1 or 2 where a block starts, 0 on the second col of a 2 by 2
+    */
+    const vector<int>& getBlocks() const { return m_block; }
+    /**
+      * @brief   Tells if D, and so A, is singular
+      * @pre     None
+      * @post    None
+      * @return  m_singular
+    */
+    bool isSingular() const { return m_singular; }
+    /**
+      * @brief   Counts the positive, negative and zero eigenvalues of A,
+                  which has the same inertia as D
+      * @pre     None
+      * @post    None
+      * @return  The inertia of A
+    */
+    Inertia getInertia() const;
+    /**
+      * @brief   Solves A x = B
+      * @pre     None
+      * @post    None
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If B does not match A or A is singular
+    */
+    vector<T> solve(const vector<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B, the columns are split
+                  across the pool
+      * @pre     None
+      * @post    None
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If B does not match A or A is singular
+    */
+    template<class Layout>
+    DenseMatrix<T, Layout> solve(const DenseMatrix<T, Layout>& B) const;
+};
+
+#include "./ldlt.hpp"
+
+#endif
@@ -0,0 +1,448 @@
+/**
+  * @file   ldlt.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the blocked Bunch-Kaufman LDL^T factorization and its solves
+*/
+#include <cmath>
+
+template<typename T>
+LDLTFactorization<T>::LDLTFactorization(const SymMatrix<T>& source, ThreadPool& pool)
+  : m_ldl(source.getRow(), source.getCol()), m_perm(source.getRow()),
+    m_block(source.getRow()), m_singular(false), m_pool(&pool)
+{
+  if(source.getRow() != source.getCol())
+  {
+    std::cerr << "Cannot LDLT factor a SymMatrix that is not square" << std::endl;
+    throw std::out_of_range("MATRIX NOT SQUARE; LDLT");
+  }
+
+  const int n = source.getRow();
+  const int ld = m_ldl.getLd();
+  T* a = m_ldl.data();
+  for(int col = 0; col < n; col++)
+  {
+    const T* aj = source.column(col);
+    for(int i = 0; i < n - col; i++)
+    {
+      a[col * ld + col + i] = aj[i];
+    }
+  }
+
+  factor();
+}
+
+template<typename T>
+void LDLTFactorization<T>::factor()
+{
+  const int n = m_ldl.getRow();
+  const int ld = m_ldl.getLd();
+  T* a = m_ldl.data();
+  for(int i = 0; i < n; i++)
+  {
+    m_perm[i] = i;
+  }
+
+  // Bunch-Kaufman threshold, bounds the growth of L for either block size
+  const T alpha = static_cast<T>((1 + std::sqrt(17.0)) / 8);
+
+  // W(i, c) is w[c * n + i], the updated col k0 + c of the panel before it
+  // is scaled into L, so W = L D over the panel
+  vector<T> work(n * (n < BLOCK ? n : BLOCK));
+  T* w = work.data();
+  const int ldw = n;
+
+  int k = 0;
+  while(k < n)
+  {
+    const int k0 = k;
+    // The last panel takes every column left, any other stops one short so
+    // a 2 by 2 block still fits
+    const int end = (n - k0 <= BLOCK ? n : k0 + BLOCK - 1);
+    while(k < end)
+    {
+      const int c = k - k0;
+      T* wc = w + c * ldw;
+
+      // W(k:n, c) = A(k:n, k) - L(k:n, k0:k) W(k, 0:c)^T
+      for(int i = k; i < n; i++)
+      {
+        wc[i] = a[k * ld + i];
+      }
+      for(int p = 0; p < c; p++)
+      {
+        const T* lp = a + (k0 + p) * ld;
+        const T wkp = w[p * ldw + k];
+        for(int i = k; i < n; i++)
+        {
+          wc[i] -= lp[i] * wkp;
+        }
+      }
+
+      int kstep = 1;
+      int kp = k;
+      const T absakk = std::abs(wc[k]);
+      int imax = k;
+      T colmax = 0;
+      for(int i = k + 1; i < n; i++)
+      {
+        if(std::abs(wc[i]) > colmax)
+        {
+          colmax = std::abs(wc[i]);
+          imax = i;
+        }
+      }
+
+      const bool empty = (absakk <= 0 && colmax <= 0);
+      if(empty)
+      {
+        // Nothing left in this column, D gets a 0 and L an empty column
+        m_singular = true;
+      }
+      else if(absakk < alpha * colmax)
+      {
+        // W(k:n, c + 1) = updated col imax, read across row imax up to the
+        // diagonal and down col imax after it
+        T* wn = w + (c + 1) * ldw;
+        for(int i = k; i < imax; i++)
+        {
+          wn[i] = a[i * ld + imax];
+        }
+        for(int i = imax; i < n; i++)
+        {
+          wn[i] = a[imax * ld + i];
+        }
+        for(int p = 0; p < c; p++)
+        {
+          const T* lp = a + (k0 + p) * ld;
+          const T wip = w[p * ldw + imax];
+          for(int i = k; i < n; i++)
+          {
+            wn[i] -= lp[i] * wip;
+          }
+        }
+
+        T rowmax = 0;
+        for(int i = k; i < n; i++)
+        {
+          if(i != imax && std::abs(wn[i]) > rowmax)
+          {
+            rowmax = std::abs(wn[i]);
+          }
+        }
+
+        if(absakk * rowmax >= alpha * colmax * colmax)
+        {
+          // Column k is good enough after all
+        }
+        else if(std::abs(wn[imax]) >= alpha * rowmax)
+        {
+          kp = imax;
+          for(int i = k; i < n; i++)
+          {
+            wc[i] = wn[i];
+          }
+        }
+        else
+        {
+          kp = imax;
+          kstep = 2;
+        }
+      }
+
+      // Symmetric interchange of kk and kp. The trailing part of A is still
+      // unupdated, col kk is overwritten from W below, so only row and col
+      // kp need the old col kk. Rows of L and W are swapped outright.
+      const int kk = k + kstep - 1;
+      if(kp != kk)
+      {
+        a[kp * ld + kp] = a[kk * ld + kk];
+        for(int j = kk + 1; j < kp; j++)
+        {
+          a[j * ld + kp] = a[kk * ld + j];
+        }
+        for(int i = kp + 1; i < n; i++)
+        {
+          a[kp * ld + i] = a[kk * ld + i];
+        }
+        for(int j = 0; j < k; j++)
+        {
+          const T temp = a[j * ld + kk];
+          a[j * ld + kk] = a[j * ld + kp];
+          a[j * ld + kp] = temp;
+        }
+        for(int p = 0; p <= kk - k0; p++)
+        {
+          const T temp = w[p * ldw + kk];
+          w[p * ldw + kk] = w[p * ldw + kp];
+          w[p * ldw + kp] = temp;
+        }
+        const int tempPerm = m_perm[kk];
+        m_perm[kk] = m_perm[kp];
+        m_perm[kp] = tempPerm;
+      }
+
+      if(kstep == 1)
+      {
+        T* ak = a + k * ld;
+        for(int i = k; i < n; i++)
+        {
+          ak[i] = wc[i];
+        }
+        if(!empty)
+        {
+          const T r1 = 1 / ak[k];
+          for(int i = k + 1; i < n; i++)
+          {
+            ak[i] *= r1;
+          }
+        }
+        m_block[k] = 1;
+      }
+      else
+      {
+        // [L(i, k) L(i, k + 1)] = [W(i, c) W(i, c + 1)] D^-1, D scaled by
+        // its off diagonal so the inverse does not overflow
+        const T* wn = w + (c + 1) * ldw;
+        const T d21 = wc[k + 1];
+        const T d11 = wn[k + 1] / d21;
+        const T d22 = wc[k] / d21;
+        const T t = 1 / (d11 * d22 - 1);
+        const T scale = t / d21;
+        T* ak = a + k * ld;
+        T* ak1 = a + (k + 1) * ld;
+        for(int i = k + 2; i < n; i++)
+        {
+          ak[i] = scale * (d11 * wc[i] - wn[i]);
+          ak1[i] = scale * (d22 * wn[i] - wc[i]);
+        }
+        ak[k] = wc[k];
+        ak[k + 1] = wc[k + 1];
+        ak1[k + 1] = wn[k + 1];
+        m_block[k] = 2;
+        m_block[k + 1] = 0;
+      }
+
+      k += kstep;
+    }
+
+    if(k == n)
+    {
+      break;
+    }
+
+    // A(k:n, k:n) -= L(k:n, k0:k) W(k:n, 0:kb)^T, by blocks of columns so
+    // only the lower half is touched past each diagonal block
+    const int kb = k - k0;
+    for(int j0 = k; j0 < n; j0 += BLOCK)
+    {
+      const int jb = (n - j0 < BLOCK ? n - j0 : BLOCK);
+      gemm(n - j0, jb, kb, static_cast<T>(-1),
+           a + k0 * ld + j0, 1, ld,
+           w + j0, ldw, 1,
+           static_cast<T>(1), a + j0 * ld + j0, 1, ld, *m_pool);
+    }
+  }
+}
+
+template<typename T>
+void LDLTFactorization<T>::substitute(T* x, const int count, const int ldx) const
+{
+  const int n = m_ldl.getRow();
+  const int ld = m_ldl.getLd();
+  const T* a = m_ldl.data();
+
+  // L y = P B, L has a unit diagonal and is the identity inside each 2 by 2
+  // block, where the slot below the diagonal holds D instead
+  for(int j = 0; j < n; j++)
+  {
+    const T* aj = a + j * ld;
+    const int first = (m_block[j] == 2 ? j + 2 : j + 1);
+    for(int c = 0; c < count; c++)
+    {
+      T* xc = x + c * ldx;
+      const T xj = xc[j];
+      for(int i = first; i < n; i++)
+      {
+        xc[i] -= aj[i] * xj;
+      }
+    }
+  }
+
+  // D z = y
+  for(int j = 0; j < n; j++)
+  {
+    const T* aj = a + j * ld;
+    if(m_block[j] == 1)
+    {
+      for(int c = 0; c < count; c++)
+      {
+        x[c * ldx + j] /= aj[j];
+      }
+    }
+    else if(m_block[j] == 2)
+    {
+      const T d21 = aj[j + 1];
+      const T d11 = aj[j] / d21;
+      const T d22 = a[(j + 1) * ld + j + 1] / d21;
+      const T denom = d11 * d22 - 1;
+      for(int c = 0; c < count; c++)
+      {
+        T* xc = x + c * ldx;
+        const T b1 = xc[j] / d21;
+        const T b2 = xc[j + 1] / d21;
+        xc[j] = (d22 * b1 - b2) / denom;
+        xc[j + 1] = (d11 * b2 - b1) / denom;
+      }
+    }
+  }
+
+  // L^T x = z, column j of L is a dot product with the x already solved
+  for(int j = n - 1; j >= 0; j--)
+  {
+    const T* aj = a + j * ld;
+    const int first = (m_block[j] == 2 ? j + 2 : j + 1);
+    for(int c = 0; c < count; c++)
+    {
+      T* xc = x + c * ldx;
+      T sum = 0;
+      for(int i = first; i < n; i++)
+      {
+        sum += aj[i] * xc[i];
+      }
+      xc[j] -= sum;
+    }
+  }
+}
+
+template<typename T>
+Inertia LDLTFactorization<T>::getInertia() const
+{
+  const int n = getSize();
+  const int ld = m_ldl.getLd();
+  const T* a = m_ldl.data();
+  Inertia inertia = {0, 0, 0};
+
+  for(int j = 0; j < n; j++)
+  {
+    const T d = a[j * ld + j];
+    if(m_block[j] == 1)
+    {
+      if(d > 0)
+      {
+        inertia.positive++;
+      }
+      else if(d < 0)
+      {
+        inertia.negative++;
+      }
+      else
+      {
+        inertia.zero++;
+      }
+    }
+    else if(m_block[j] == 2)
+    {
+      // Bunch-Kaufman only takes a 2 by 2 block with a negative determinant,
+      // one eigenvalue of each sign
+      const T b = a[j * ld + j + 1];
+      const T e = a[(j + 1) * ld + j + 1];
+      const T det = d * e - b * b;
+      if(det < 0)
+      {
+        inertia.positive++;
+        inertia.negative++;
+      }
+      else
+      {
+        // Never picked, but a singular or definite block is still counted
+        const int same = (det > 0 ? 2 : 1);
+        if(d + e > 0)
+        {
+          inertia.positive += same;
+        }
+        else
+        {
+          inertia.negative += same;
+        }
+        inertia.zero += 2 - same;
+      }
+    }
+  }
+
+  return inertia;
+}
+
+template<typename T>
+vector<T> LDLTFactorization<T>::solve(const vector<T>& B) const
+{
+  if(B.getSize() != getSize())
+  {
+    std::cerr << "Vector B size does not match the LDLT size." << std::endl;
+    throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE; LDLT");
+  }
+  if(m_singular)
+  {
+    std::cerr << "Cannot solve with a singular LDLT factorization" << std::endl;
+    throw std::runtime_error("SINGULAR MATRIX; LDLT");
+  }
+
+  vector<T> y(getSize());
+  for(int i = 0; i < getSize(); i++)
+  {
+    y[i] = B[m_perm[i]];
+  }
+  substitute(y.data(), 1, getSize());
+
+  vector<T> x(getSize());
+  for(int i = 0; i < getSize(); i++)
+  {
+    x[m_perm[i]] = y[i];
+  }
+
+  return x;
+}
+
+template<typename T>
+template<class Layout>
+DenseMatrix<T, Layout> LDLTFactorization<T>::solve(const DenseMatrix<T, Layout>& B) const
+{
+  if(B.getRow() != getSize())
+  {
+    std::cerr << "Matrix B rows do not match the LDLT size." << std::endl;
+    throw std::out_of_range("MISS MATCHING MATRIX SIZES; LDLT");
+  }
+  if(m_singular)
+  {
+    std::cerr << "Cannot solve with a singular LDLT factorization" << std::endl;
+    throw std::runtime_error("SINGULAR MATRIX; LDLT");
+  }
+
+  const int n = getSize();
+  const int k = B.getCol();
+  DenseMatrix<T> work(n, k);
+  T* w = work.data();
+  const int ld = work.getLd();
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      w[col * ld + row] = B(col, m_perm[row]);
+    }
+  }
+
+  m_pool->parallelFor(0, k, [&](const int first, const int last)
+  {
+    substitute(w + first * ld, last - first, ld);
+  });
+
+  DenseMatrix<T, Layout> X(n, k);
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      X(col, m_perm[row]) = w[col * ld + row];
+    }
+  }
+
+  return X;
+}
@@ -12,6 +12,8 @@
 #define LOWER_H
 
 #include "./matrix.h"
+#include "./aligned.h"
+#include "./blas.h"
 
 template<class T>
 class LowerTriangle : public matrix<LowerTriangle<T>, T>
@@ -19,25 +21,17 @@ class LowerTriangle : public matrix<LowerTriangle<T>, T>
   private:
     int m_rows;
     int m_cols;
-    vector<vector<T>> ptr_to_data;
+    // Packed by column, column col holds rows col .. m_rows - 1
+    AlignedBuffer<T> ptr_to_data;
     /**
-      * @brief   Allows the ability to change the vector returned from using []
-      * @pre     index must be greater than or equal to zero and less than m_cols
-      * @post    The vector accessed is able to be changed
-      * @param   index - Used to access ptr_to_vector
-      * @return  A position in ptr_to_vector
-      * @throw   If index is lower than zero or larger than m_cols
-    */
-    vector<T>& operator[](const int index) { return ptr_to_data[index]; }
-    /**
-      * @brief   Allows the ability to read from ptr_to_vector
-      * @pre     index must be greater than or equal to zero and less than m_cols
+      * @brief   Finds where a column starts in ptr_to_data
+      * @pre     None
       * @post    None
-      * @param   index - Used to access ptr_to_vector
-      * @return  A vector from ptr_to_vector
-      * @throw   If index is lower than zero or larger than m_cols
+      * @param   col - column of the matrix
+      * @return  Index of (col, col)
     */
-    const vector<T>& operator[](const int index) const { return ptr_to_data[index]; }
+    std::ptrdiff_t offset(const int col) const
+    { return static_cast<std::ptrdiff_t>(col) * m_rows - static_cast<std::ptrdiff_t>(col) * (col - 1) / 2; }
   public:
     /**
       * @brief   Sets row and col to 0 and sets our point to nullptr
@@ -45,16 +39,17 @@ class LowerTriangle : public matrix<LowerTriangle<T>, T>
       * @post    All member variables are set.
       * @return  None
     */
-    LowerTriangle() : m_rows(0), m_cols(0), ptr_to_data(vector<vector<T>>()) {};
+    LowerTriangle() : m_rows(0), m_cols(0), ptr_to_data(AlignedBuffer<T>()) {};
     /**
       * @brief   Confirms LowerTriangle row and col are proper values
                   then initialises ptr_to_vector
-      * @pre     rows and cols must be greater than zero
+      * @pre     rows and cols must be greater than zero, r at least c
       * @post    Creates a fresh LowerTriangle of size rows and cols
       * @param   r - How tall the LowerTriangle should be
       * @param   c - How many vectors wide it should be
       * @return  None
-      * @throw   If r or r is 0 or less
+      * @throw   If r or r is 0 or less, r is less than c or the
+                  triangle holds more values than an int counts
     */
     LowerTriangle(const int r, const int c);
     /**
@@ -123,6 +118,22 @@ class LowerTriangle : public matrix<LowerTriangle<T>, T>
       * @throw   If col or row are out of bounds
     */
     T& operator()(const int col, const int row);
+    /**
+      * @brief   Gets the stored part of a column, from the diagonal down
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, col), row col + i is at [i]
+    */
+    T* column(const int col) { return ptr_to_data.data() + offset(col); }
+    /**
+      * @brief   Gets the stored part of a column, from the diagonal down
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, col), row col + i is at [i]
+    */
+    const T* column(const int col) const { return ptr_to_data.data() + offset(col); }
 };
 
 /**
@@ -177,7 +188,8 @@ template<typename T>
 vector<T> operator*(const LowerTriangle<T>& lhs, const vector<T>& rhs);
 
 /**
-  * @brief   Transposes the LowerTriangle, easier than multiplying by the ident LowerTriangle
+  * @brief   Transposes the LowerTriangle, easier than multiplying by the ident LowerTriangle.
+              transposedView reads L^T without this copy.
   * @pre     None
   * @post    None
   * @param   source - The LowerTriangle to transpose, or "flip"
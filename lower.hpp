@@ -12,18 +12,15 @@ LowerTriangle<T>::LowerTriangle(const int r, const int c)
     std::cerr << "Row or Cols set less than zero" << std::endl;
     throw std::out_of_range("Tried to set illegal bounds of matrix");
   }
+  if(r < c)
+  {
+    std::cerr << "LowerTriangle cannot be wider than it is tall" << std::endl;
+    throw std::out_of_range("WIDER THAN TALL; LOWER");
+  }
   m_rows = r;
   m_cols = c;
 
-  ptr_to_data = vector<vector<T>>(m_cols);
-
-  int rowReducer = 0;
-
-  for(int i = 0; i < m_cols; i++)
-  {
-    ptr_to_data[i] = vector<T>(m_rows - rowReducer);
-    rowReducer++;
-  }
+  ptr_to_data = AlignedBuffer<T>(offset(m_cols));
 }
 
 template<typename T>
@@ -90,29 +87,35 @@ template<typename T>
 LowerTriangle<T> operator*(const LowerTriangle<T>& lhs, 
                             const LowerTriangle<T>& rhs)
 {
-  if(lhs.getCol() != rhs.getRow())
+  if(lhs.getCol() != rhs.getRow() || lhs.getRow() != lhs.getCol() || rhs.getRow() != rhs.getCol())
   {
     std::cerr << "lhs column doesn't match rhs row size" << std::endl;
+    throw std::out_of_range("MISMATCHED SIZES");
   }
 
-  LowerTriangle<T> temp(lhs.getRow(), rhs.getCol());
-  vector<T> rowVec(lhs.getCol());
-
-  for(int row = 0; row < lhs.getRow(); row++)
+  // rhs is spread into a zeroed n by n block, tpmm turns it into lhs rhs
+  // and the lower half of the block is the product
+  const int n = lhs.getRow();
+  AlignedBuffer<T> work(static_cast<std::ptrdiff_t>(n) * n);
+  T* w = work.data();
+  for(int col = 0; col < n; col++)
   {
-    for(int k = 0; k < lhs.getCol(); k++)
+    const T* r = rhs.column(col);
+    for(int i = 0; i < n - col; i++)
     {
-      rowVec[k] = lhs(k, row);
+      w[col * n + col + i] = r[i];
     }
+  }
+
+  tpmm(LOWER_TRIANGLE, NO_TRANSPOSE, n, lhs.column(0), n, w, n);
 
-    for(int col = 0; col <= row; col++)
+  LowerTriangle<T> temp(n, n);
+  for(int col = 0; col < n; col++)
+  {
+    T* t = temp.column(col);
+    for(int i = 0; i < n - col; i++)
     {
-      double sum = 0;
-      for(int i = col; i <= row; i++)
-      {
-        sum += rowVec[i] * rhs(col, i);
-      }
-      temp(col, row) = sum;
+      t[i] = w[col * n + col + i];
     }
   }
 
@@ -122,32 +125,14 @@ LowerTriangle<T> operator*(const LowerTriangle<T>& lhs,
 template<typename T>
 vector<T> operator*(const LowerTriangle<T>& lhs, const vector<T>& rhs)
 {
-  if(lhs.getCol() != rhs.getSize())
+  if(lhs.getCol() != rhs.getSize() || lhs.getRow() != lhs.getCol())
   {
     std::cerr << "vector size does not match lower col" << std::endl;
     throw std::out_of_range("MISMATCHED VECTOR AND MATRIX SIZE");
   }
-  
-  vector<T> temp(rhs.getSize());
-  vector<T> rowVec(rhs.getSize());
 
-  for(int row = 0; row < lhs.getRow(); row++)
-  {
-    for(int k = 0; k < lhs.getCol(); k++)
-    {
-      rowVec[k] = lhs(k, row);
-    }
-
-    for(int col = row; col < lhs.getCol(); col++)
-    {
-      double sum = 0;
-      for(int i = row; i <= col; i++)
-      {
-        sum += rowVec[i] * rhs[i];
-      }
-      temp[row] = sum;
-    }
-  }
+  vector<T> temp(rhs);
+  tpmv(LOWER_TRIANGLE, NO_TRANSPOSE, lhs.getRow(), lhs.column(0), temp.data());
 
   return temp;
 }
@@ -155,24 +140,36 @@ vector<T> operator*(const LowerTriangle<T>& lhs, const vector<T>& rhs)
 template<typename T>
 T LowerTriangle<T>::operator()(const int col, const int row) const
 {
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+  {
+    std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; LOWER");
+  }
+
   if(col > row)
   {
     return 0;
   }
 
-  return ptr_to_data[col][row-col];
+  return ptr_to_data.data()[offset(col) + row - col];
 }
 
 template<typename T>
 T& LowerTriangle<T>::operator()(const int col, const int row)
 {
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+  {
+    std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; LOWER");
+  }
+
   if(col > row)
   {
     std::cerr << "Tried to make an lower not an lower matrix" << std::endl;
     throw std::out_of_range("Tried to set 0 to a value");
   }
 
-  return ptr_to_data[col][row-col];
+  return ptr_to_data.data()[offset(col) + row - col];
 }
 
 template<typename T>
@@ -0,0 +1,119 @@
+/**
+  * @file   lu.h
+  * @author Dylan Warren, Section A
+  * @brief  The LU factorization of a square DenseMatrix, P A = L U, kept so
+            it can solve for any number of right hand sides.
+*/
+/**
+  * @class  LUFactorization
+  * @brief  LUFactorization is right-looking and blocked. A panel of BLOCK
+  *         columns is factored with pivoting, the rows of U beside it are
+  *         solved with its unit lower triangle, and the trailing matrix is
+  *         updated with one gemm. Row swaps are kept in a permutation vector
+  *         and the factors overwrite one column major copy of A.
+*/
+#ifndef LU_H
+#define LU_H
+
+#include <stdexcept>
+#include "./dense.h"
+#include "./blas.h"
+#include "./threadpool.h"
+
+/** How the pivot row of each column is picked */
+enum PivotType
+{
+  PARTIAL_PIVOT = 0,
+  SCALED_PIVOT = 1
+};
+
+template<class T>
+class LUFactorization
+{
+  private:
+    DenseMatrix<T> m_lu;
+    vector<int> m_perm;
+    ThreadPool* m_pool;
+    /**
+      * @brief   Factors m_lu in place, filling m_perm
+      * @pre     m_lu holds A
+      * @post    m_lu holds L below the diagonal (unit diagonal not stored)
+                  and U on and above it
+      * @param   pivot - PivotType to use
+      * @return  None
+      * @throw   If A is singular
+    */
+    void factor(const int pivot);
+    /**
+      * @brief   Solves L U x = y in place for count right hand sides
+      * @pre     x holds y, already permuted, one column every ldx values
+      * @post    x holds the solutions
+      * @param   x - First right hand side
+      * @param   count - Right hand sides
+      * @param   ldx - Distance between right hand sides
+      * @return  None
+    */
+    void substitute(T* x, const int count, const int ldx) const;
+  public:
+    /** Columns in one panel */
+    static const int BLOCK = 64;
+    /**
+      * @brief   Copies and factors source
+      * @pre     source must be square and not singular
+      * @post    The factorization is ready to solve with
+      * @param   source - Matrix "A"
+      * @param   pivot - PARTIAL_PIVOT or SCALED_PIVOT, which divides each
+                  candidate by the largest entry of its row in A
+      * @param   pool - Threads to update the trailing matrix with
+      * @return  None
+      * @throw   If source is not square or is singular
+    */
+    template<class Layout>
+    LUFactorization(const DenseMatrix<T, Layout>& source, const int pivot = SCALED_PIVOT,
+                    ThreadPool& pool = ThreadPool::global());
+    /**
+      * @brief   Gets the order of A
+      * @pre     None
+      * @post    None
+      * @return  Rows of A
+    */
+    int getSize() const { return m_lu.getRow(); }
+    /**
+      * @brief   Gets L and U packed together
+      * @pre     None
+      * @post    None
+      * @return  m_lu
+    */
+    const DenseMatrix<T>& getLU() const { return m_lu; }
+    /**
+      * @brief   Gets the row swaps, row i of P A is row getPermutation()[i] of A
+      * @pre     None
+      * @post    None
+      * @return  m_perm
+    */
+    const vector<int>& getPermutation() const { return m_perm; }
+    /**
+      * @brief   Solves A x = B
+      * @pre     None
+      * @post    None
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If B does not match A
+    */
+    vector<T> solve(const vector<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B, the columns are split
+                  across the pool
+      * @pre     None
+      * @post    None
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If B does not match A
+    */
+    template<class Layout>
+    DenseMatrix<T, Layout> solve(const DenseMatrix<T, Layout>& B) const;
+};
+
+#include "./lu.hpp"
+
+#endif
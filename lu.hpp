@@ -0,0 +1,249 @@
+/**
+  * @file   lu.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the blocked LU factorization and its solves
+*/
+#include <cmath>
+
+template<typename T>
+template<class Layout>
+LUFactorization<T>::LUFactorization(const DenseMatrix<T, Layout>& source, const int pivot,
+                                    ThreadPool& pool)
+  : m_lu(source.getRow(), source.getCol()), m_perm(source.getRow()), m_pool(&pool)
+{
+  if(source.getRow() != source.getCol())
+  {
+    std::cerr << "Cannot LU factor a DenseMatrix that is not square" << std::endl;
+    throw std::out_of_range("MATRIX NOT SQUARE; LU");
+  }
+
+  const int n = source.getRow();
+  const int ld = m_lu.getLd();
+  T* a = m_lu.data();
+  for(int col = 0; col < n; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      a[col * ld + row] = source(col, row);
+    }
+  }
+
+  factor(pivot);
+}
+
+template<typename T>
+void LUFactorization<T>::factor(const int pivot)
+{
+  const int n = m_lu.getRow();
+  const int ld = m_lu.getLd();
+  T* a = m_lu.data();
+
+  // A(i, j) is a[j * ld + i], so every column walk below is contiguous
+  vector<T> scale(n);
+  for(int i = 0; i < n; i++)
+  {
+    m_perm[i] = i;
+    scale[i] = 1;
+  }
+  if(pivot == SCALED_PIVOT)
+  {
+    for(int i = 0; i < n; i++)
+    {
+      scale[i] = 0;
+    }
+    for(int j = 0; j < n; j++)
+    {
+      for(int i = 0; i < n; i++)
+      {
+        scale[i] = (std::abs(a[j * ld + i]) > scale[i] ? std::abs(a[j * ld + i]) : scale[i]);
+      }
+    }
+  }
+
+  for(int j0 = 0; j0 < n; j0 += BLOCK)
+  {
+    const int jb = (n - j0 < BLOCK ? n - j0 : BLOCK);
+
+    // Panel, columns j0 .. j0 + jb - 1 of rows j0 .. n - 1
+    for(int j = j0; j < j0 + jb; j++)
+    {
+      T* aj = a + j * ld;
+      int p = j;
+      T best = 0;
+      for(int i = j; i < n; i++)
+      {
+        if(scale[i] > 0 && std::abs(aj[i]) / scale[i] > best)
+        {
+          best = std::abs(aj[i]) / scale[i];
+          p = i;
+        }
+      }
+      if(best <= 0)
+      {
+        std::cerr << "Cannot LU factor a singular DenseMatrix" << std::endl;
+        throw std::runtime_error("SINGULAR MATRIX; LU");
+      }
+
+      if(p != j)
+      {
+        for(int col = 0; col < n; col++)
+        {
+          const T temp = a[col * ld + j];
+          a[col * ld + j] = a[col * ld + p];
+          a[col * ld + p] = temp;
+        }
+        const T tempScale = scale[j];
+        scale[j] = scale[p];
+        scale[p] = tempScale;
+        const int tempPerm = m_perm[j];
+        m_perm[j] = m_perm[p];
+        m_perm[p] = tempPerm;
+      }
+
+      const T diag = aj[j];
+      for(int i = j + 1; i < n; i++)
+      {
+        aj[i] /= diag;
+      }
+      for(int col = j + 1; col < j0 + jb; col++)
+      {
+        T* ac = a + col * ld;
+        const T ujc = ac[j];
+        for(int i = j + 1; i < n; i++)
+        {
+          ac[i] -= aj[i] * ujc;
+        }
+      }
+    }
+
+    const int next = j0 + jb;
+    if(next == n)
+    {
+      break;
+    }
+
+    // U12 = L11^-1 A12, one column at a time
+    m_pool->parallelFor(next, n, [&](const int first, const int last)
+    {
+      for(int col = first; col < last; col++)
+      {
+        T* ac = a + col * ld;
+        for(int j = j0; j < next; j++)
+        {
+          const T* aj = a + j * ld;
+          const T ujc = ac[j];
+          for(int i = j + 1; i < next; i++)
+          {
+            ac[i] -= aj[i] * ujc;
+          }
+        }
+      }
+    });
+
+    // A22 -= L21 U12
+    const int rest = n - next;
+    gemm(rest, rest, jb, static_cast<T>(-1),
+         a + j0 * ld + next, 1, ld,
+         a + next * ld + j0, 1, ld,
+         static_cast<T>(1), a + next * ld + next, 1, ld, *m_pool);
+  }
+}
+
+template<typename T>
+void LUFactorization<T>::substitute(T* x, const int count, const int ldx) const
+{
+  const int n = m_lu.getRow();
+  const int ld = m_lu.getLd();
+  const T* a = m_lu.data();
+
+  // L y = P B, L has a unit diagonal. Each column of L is loaded once and
+  // applied to every right hand side.
+  for(int j = 0; j < n; j++)
+  {
+    const T* aj = a + j * ld;
+    for(int c = 0; c < count; c++)
+    {
+      T* xc = x + c * ldx;
+      const T xj = xc[j];
+      for(int i = j + 1; i < n; i++)
+      {
+        xc[i] -= aj[i] * xj;
+      }
+    }
+  }
+
+  // U x = y
+  for(int j = n - 1; j >= 0; j--)
+  {
+    const T* aj = a + j * ld;
+    for(int c = 0; c < count; c++)
+    {
+      T* xc = x + c * ldx;
+      xc[j] /= aj[j];
+      const T xj = xc[j];
+      for(int i = 0; i < j; i++)
+      {
+        xc[i] -= aj[i] * xj;
+      }
+    }
+  }
+}
+
+template<typename T>
+vector<T> LUFactorization<T>::solve(const vector<T>& B) const
+{
+  if(B.getSize() != getSize())
+  {
+    std::cerr << "Vector B size does not match the LU size." << std::endl;
+    throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE; LU");
+  }
+
+  vector<T> x(getSize());
+  for(int i = 0; i < getSize(); i++)
+  {
+    x[i] = B[m_perm[i]];
+  }
+  substitute(x.data(), 1, getSize());
+
+  return x;
+}
+
+template<typename T>
+template<class Layout>
+DenseMatrix<T, Layout> LUFactorization<T>::solve(const DenseMatrix<T, Layout>& B) const
+{
+  if(B.getRow() != getSize())
+  {
+    std::cerr << "Matrix B rows do not match the LU size." << std::endl;
+    throw std::out_of_range("MISS MATCHING MATRIX SIZES; LU");
+  }
+
+  const int n = getSize();
+  const int k = B.getCol();
+  DenseMatrix<T> work(n, k);
+  T* w = work.data();
+  const int ld = work.getLd();
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      w[col * ld + row] = B(col, m_perm[row]);
+    }
+  }
+
+  m_pool->parallelFor(0, k, [&](const int first, const int last)
+  {
+    substitute(w + first * ld, last - first, ld);
+  });
+
+  DenseMatrix<T, Layout> X(n, k);
+  for(int col = 0; col < k; col++)
+  {
+    for(int row = 0; row < n; row++)
+    {
+      X(col, row) = w[col * ld + row];
+    }
+  }
+
+  return X;
+}
@@ -36,11 +36,13 @@ int main(int argc, char** argv)
   }
 
   int size = std::stoi(argv[1]);
-  bool cholesky = std::stoi(argv[2]);
+  // 0 Gaussian, 1 Cholesky, 2 conjugate gradient, 3 multigrid,
+  // 4 fast Poisson, 5 red-black SOR, 6 sparse Cholesky; see SolverType
+  int alg = (argc > 2 ? std::stoi(argv[2]) : FAST_POISSON);
   std::ofstream out("output.txt");
 
   //Gets Data to "output.txt"
-  vector<double> v = PDE(xUp, xLow, yUp, yLow, forced, size, cholesky);
+  vector<double> v = PDE(xUp, xLow, yUp, yLow, forced, size, alg);
   
   for(int y = 0; y < size+1; y++)
   {
@@ -0,0 +1,127 @@
+/**
+  * @file   multigrid.h
+  * @author Dylan Warren, Oscar Lewzcuk, Section A
+  * @brief  The multigrid class is a "functor" class, it solves the five point
+            Poisson system on a hierarchy of coarser meshes.
+*/
+/**
+  * @class  MultigridSolver
+  * @brief  MultigridSolver takes N to (N + 1) / 2 per level, smooths with
+  *         red-black Gauss-Seidel, prolongs bilinearly, restricts with the
+  *         transpose of that and solves the coarsest mesh with band
+  *         Cholesky. For an even N the meshes nest and the transfers are the
+  *         usual full weighting and bilinear ones, an odd N puts the coarse
+  *         points between fine ones and interpolates to them.
+*/
+#ifndef MULTIGRID_H
+#define MULTIGRID_H
+
+#include "./poisson.h"
+#include "./solver.h"
+
+/** Order the coarse meshes are visited in, per level */
+enum CycleType
+{
+  V_CYCLE = 0,
+  W_CYCLE = 1,
+  F_CYCLE = 2
+};
+
+template<class T>
+class MultigridSolver
+{
+  private:
+    int m_cycleType;
+    int m_smooth;
+    int m_coarsest;
+    T m_tolerance;
+    int m_maxCycles;
+    int m_cycles;
+    T m_residual;
+    // Per level, finest first
+    vector<int> m_partitions;
+    vector<vector<T>> m_u;
+    vector<vector<T>> m_f;
+    vector<vector<T>> m_r;
+    // Per level but the coarsest, coarse rows by fine cols for the transfers
+    vector<vector<T>> m_t;
+    /**
+      * @brief   Runs one cycle from level down to the coarsest mesh
+      * @pre     m_f[level] holds the right hand side of level
+      * @post    m_u[level] is improved
+      * @param   level - Mesh to start on, 0 is the finest
+      * @param   type - CycleType to run
+      * @return  None
+    */
+    void cycle(const int level, const int type);
+    /**
+      * @brief   Red-black Gauss-Seidel sweeps on level
+      * @pre     None
+      * @post    m_u[level] is smoothed
+      * @param   level - Mesh to smooth
+      * @param   sweeps - How many red then black sweeps to do
+      * @return  None
+    */
+    void smooth(const int level, const int sweeps);
+    /**
+      * @brief   Solves the coarsest mesh directly with band Cholesky
+      * @pre     level is the last level
+      * @post    m_u[level] is the exact solution of that mesh
+      * @param   level - The coarsest mesh
+      * @return  None
+    */
+    void solveCoarsest(const int level);
+  public:
+    /**
+      * @brief   Sets the cycle and when the solver stops
+      * @pre     tolerance must be positive, the counts must be at least 1
+                  and coarsest at least 2
+      * @post    Creates a solver
+      * @param   cycleType - V_CYCLE, W_CYCLE or F_CYCLE
+      * @param   tolerance - Stop once ||B - A x|| / ||B|| is below this
+      * @param   maxCycles - Most cycles to run
+      * @param   smooth - Sweeps before and after every coarse correction
+      * @param   coarsest - Stop coarsening once N is at or below this
+      * @return  None
+      * @throw   If any of the settings are out of range
+    */
+    MultigridSolver(const int cycleType = V_CYCLE,
+                    const T tolerance = static_cast<T>(1e-10),
+                    const int maxCycles = 100, const int smooth = 2,
+                    const int coarsest = 4);
+    /**
+      * @brief   Solves A x = B for the five point operator A
+      * @pre     B must come from PartialDiff::makeRHS with the same N as A
+      * @post    getCycles and getResidual describe this solve
+      * @param   A - The operator of the finest mesh
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector, the last iterate if it never converged
+      * @throw   If B does not match the size of A
+    */
+    vector<T> operator()(const PoissonOperator<T>& A, const vector<T>& B);
+    /**
+      * @brief   Gets how many cycles the last solve took
+      * @pre     None
+      * @post    None
+      * @return  m_cycles
+    */
+    int getCycles() const { return m_cycles; }
+    /**
+      * @brief   Gets ||B - A x|| / ||B|| from the end of the last solve
+      * @pre     None
+      * @post    None
+      * @return  m_residual
+    */
+    T getResidual() const { return m_residual; }
+    /**
+      * @brief   Checks if the last solve reached the tolerance
+      * @pre     None
+      * @post    None
+      * @return  True if the final residual is under the tolerance
+    */
+    bool converged() const { return m_residual <= m_tolerance; }
+};
+
+#include "./multigrid.hpp"
+
+#endif
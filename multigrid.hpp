@@ -0,0 +1,311 @@
+/**
+  * @file   multigrid.hpp
+  * @author Dylan Warren, Oscar Lewzcuk, Section A
+  * @brief  Defines the () operator and cycles of MultigridSolver
+*/
+#include <exception>
+#include <cmath>
+
+template<typename T>
+MultigridSolver<T>::MultigridSolver(const int cycleType, const T tolerance,
+                                    const int maxCycles, const int smooth,
+                                    const int coarsest)
+{
+  if(cycleType < V_CYCLE || cycleType > F_CYCLE)
+  {
+    throw std::out_of_range("Unknown cycle type given");
+  }
+  if(tolerance <= 0 || maxCycles < 1 || smooth < 1 || coarsest < 2)
+  {
+    std::cerr << "Bad multigrid settings" << std::endl;
+    throw std::out_of_range("BAD SETTINGS; MULTIGRID");
+  }
+
+  m_cycleType = cycleType;
+  m_tolerance = tolerance;
+  m_maxCycles = maxCycles;
+  m_smooth = smooth;
+  m_coarsest = coarsest;
+  m_cycles = 0;
+  m_residual = 0;
+}
+
+template<typename T>
+vector<T> MultigridSolver<T>::operator()(const PoissonOperator<T>& A,
+                                         const vector<T>& B)
+{
+  if(A.getRow() != B.getSize())
+  {
+    std::cerr << "Multigrid operator size does not match vector size" << std::endl;
+    throw std::out_of_range("OPERATOR SIZE DOES NOT MATCH VECTOR SIZE; MULTIGRID");
+  }
+
+  // Halve N, rounding up, so an odd N is coarsened as far as an even one
+  int levels = 1;
+  int N = A.getPartitions();
+  while(N > m_coarsest && (N + 1) / 2 >= 2)
+  {
+    N = (N + 1) / 2;
+    levels++;
+  }
+
+  m_partitions = vector<int>(levels);
+  m_u = vector<vector<T>>(levels);
+  m_f = vector<vector<T>>(levels);
+  m_r = vector<vector<T>>(levels);
+  m_t = vector<vector<T>>(levels);
+  N = A.getPartitions();
+  for(int l = 0; l < levels; l++)
+  {
+    const int size = (N - 1) * (N - 1);
+    m_partitions[l] = N;
+    m_u[l] = vector<T>(size);
+    m_f[l] = vector<T>(size);
+    m_r[l] = vector<T>(size);
+    if(l < levels - 1)
+    {
+      m_t[l] = vector<T>((N - 1) * ((N + 1) / 2 - 1));
+    }
+    N = (N + 1) / 2;
+  }
+  m_f[0] = B;
+
+  T bNorm = 0;
+  for(int i = 0; i < B.getSize(); i++)
+  {
+    bNorm += B[i] * B[i];
+  }
+  bNorm = std::sqrt(bNorm);
+
+  m_cycles = 0;
+  m_residual = 0;
+  if(bNorm == 0)
+  {
+    return m_u[0];
+  }
+
+  m_residual = 1;
+  while(m_cycles < m_maxCycles && m_residual > m_tolerance)
+  {
+    cycle(0, m_cycleType);
+    m_cycles++;
+
+    A.residual(m_f[0], m_u[0], m_r[0]);
+    const T* r = m_r[0].data();
+    T rNorm = 0;
+    for(int i = 0; i < B.getSize(); i++)
+    {
+      rNorm += r[i] * r[i];
+    }
+    m_residual = std::sqrt(rNorm) / bNorm;
+  }
+
+  return m_u[0];
+}
+
+template<typename T>
+void MultigridSolver<T>::cycle(const int level, const int type)
+{
+  if(level == m_partitions.getSize() - 1)
+  {
+    solveCoarsest(level);
+    return;
+  }
+
+  smooth(level, m_smooth);
+
+  const int fineN = m_partitions[level];
+  const int coarseN = m_partitions[level + 1];
+  const int fineLine = fineN - 1;
+  const int coarseLine = coarseN - 1;
+  PoissonOperator<T>(fineN).residual(m_f[level], m_u[level], m_r[level]);
+
+  // Fine point i of a line sits at I + w in coarse units, between coarse
+  // points I and I + 1. Halving an even N gives I = i / 2 and w = 0 or 1/2.
+  auto locate = [&](const int i, int& I, T& w)
+  {
+    const long long scaled = static_cast<long long>(i) * coarseN;
+    I = static_cast<int>(scaled / fineN);
+    w = static_cast<T>(scaled - static_cast<long long>(I) * fineN) / static_cast<T>(fineN);
+  };
+
+  // Restriction is P^T for the bilinear P below. The coarse A is the five
+  // point stencil scaled by H^2 / 4, so with R = (h / H)^2 P^T its right hand
+  // side (H / h)^2 R r is P^T r, which for an even N is 4 times full weighting.
+  // P is applied a direction at a time, along x into m_t, then along y.
+  const T* r = m_r[level].data();
+  T* t = m_t[level].data();
+  T* fc = m_f[level + 1].data();
+  T* uc = m_u[level + 1].data();
+  for(int k = 0; k < fineLine * coarseLine; k++)
+  {
+    t[k] = 0;
+  }
+  for(int k = 0; k < coarseLine * coarseLine; k++)
+  {
+    fc[k] = 0;
+    uc[k] = 0;
+  }
+  for(int x = 1; x <= fineLine; x++)
+  {
+    int I;
+    T w;
+    locate(x, I, w);
+    for(int y = 0; y < fineLine; y++)
+    {
+      const T value = r[y * fineLine + x - 1];
+      if(I >= 1)
+      {
+        t[y * coarseLine + I - 1] += (1 - w) * value;
+      }
+      if(I < coarseLine)
+      {
+        t[y * coarseLine + I] += w * value;
+      }
+    }
+  }
+  for(int y = 1; y <= fineLine; y++)
+  {
+    int J;
+    T w;
+    locate(y, J, w);
+    const T* ty = t + (y - 1) * coarseLine;
+    if(J >= 1)
+    {
+      T* low = fc + (J - 1) * coarseLine;
+      for(int I = 0; I < coarseLine; I++)
+      {
+        low[I] += (1 - w) * ty[I];
+      }
+    }
+    if(J < coarseLine)
+    {
+      T* high = fc + J * coarseLine;
+      for(int I = 0; I < coarseLine; I++)
+      {
+        high[I] += w * ty[I];
+      }
+    }
+  }
+
+  if(type == W_CYCLE)
+  {
+    cycle(level + 1, W_CYCLE);
+    cycle(level + 1, W_CYCLE);
+  }
+  else if(type == F_CYCLE)
+  {
+    cycle(level + 1, F_CYCLE);
+    cycle(level + 1, V_CYCLE);
+  }
+  else
+  {
+    cycle(level + 1, V_CYCLE);
+  }
+
+  // Bilinear prolongation of the correction, which is 0 on the boundary.
+  // The coarsest solve replaces its vector, so look the correction up again.
+  // Each coarse row is spread along x into m_t, then the rows along y.
+  T* u = m_u[level].data();
+  const T* correction = m_u[level + 1].data();
+  for(int x = 1; x <= fineLine; x++)
+  {
+    int I;
+    T w;
+    locate(x, I, w);
+    for(int J = 0; J < coarseLine; J++)
+    {
+      const T* cJ = correction + J * coarseLine;
+      t[J * fineLine + x - 1] = (I >= 1 ? (1 - w) * cJ[I - 1] : 0)
+                                + (I < coarseLine ? w * cJ[I] : 0);
+    }
+  }
+  for(int y = 1; y <= fineLine; y++)
+  {
+    int J;
+    T w;
+    locate(y, J, w);
+    T* uy = u + (y - 1) * fineLine;
+    if(J >= 1)
+    {
+      const T* low = t + (J - 1) * fineLine;
+      for(int x = 0; x < fineLine; x++)
+      {
+        uy[x] += (1 - w) * low[x];
+      }
+    }
+    if(J < coarseLine)
+    {
+      const T* high = t + J * fineLine;
+      for(int x = 0; x < fineLine; x++)
+      {
+        uy[x] += w * high[x];
+      }
+    }
+  }
+
+  smooth(level, m_smooth);
+}
+
+template<typename T>
+void MultigridSolver<T>::smooth(const int level, const int sweeps)
+{
+  const int line = m_partitions[level] - 1;
+  T* u = m_u[level].data();
+  const T* f = m_f[level].data();
+
+  // u(xj, yk) = f + 1/4 [neighbours], red points ((j + k) even) then black
+  // ones, which only read the other colour so each half can go in any order.
+  for(int s = 0; s < sweeps; s++)
+  {
+    for(int colour = 0; colour < 2; colour++)
+    {
+      for(int k = 0; k < line; k++)
+      {
+        T* uk = u + k * line;
+        const T* fk = f + k * line;
+        for(int j = (k + colour) % 2; j < line; j += 2)
+        {
+          T sum = 0;
+          if(j > 0)
+          {
+            sum += uk[j - 1];
+          }
+          if(j < line - 1)
+          {
+            sum += uk[j + 1];
+          }
+          if(k > 0)
+          {
+            sum += uk[j - line];
+          }
+          if(k < line - 1)
+          {
+            sum += uk[j + line];
+          }
+          uk[j] = fk[j] + static_cast<T>(0.25) * sum;
+        }
+      }
+    }
+  }
+}
+
+template<typename T>
+void MultigridSolver<T>::solveCoarsest(const int level)
+{
+  const PoissonOperator<T> A(m_partitions[level]);
+  const int line = m_partitions[level] - 1;
+  const int n = A.getRow();
+
+  BandSymMatrix<T> coarse(n, line);
+  for(int row = 0; row < n; row++)
+  {
+    for(int col = (row - line > 0 ? row - line : 0); col <= row; col++)
+    {
+      coarse(col, row) = A(col, row);
+    }
+  }
+
+  GaussianSolver<T> solver;
+  m_u[level] = solver(coarse, m_f[level]);
+}
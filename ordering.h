@@ -0,0 +1,86 @@
+/**
+  * @file   ordering.h
+  * @author Dylan Warren, Section A
+  * @brief  Fill and bandwidth reducing orderings for sparse symmetric
+            factorizations. Every ordering is a permutation perm where
+            perm[k] is the old row placed at position k.
+*/
+
+#ifndef ORDERING_H
+#define ORDERING_H
+
+#include "./sparse.h"
+
+/**
+  * @brief   Builds the graph of a symmetric pattern, one list of neighbours
+              per row with the diagonal left out
+  * @pre     A must be square
+  * @post    start and index are overwritten, general storage is made
+              symmetric
+  * @param   A - Matrix in symmetric or general storage
+  * @param   start - n + 1 offsets into index
+  * @param   index - Neighbours of every row, row by row
+  * @return  None
+  * @throw   If A is not square
+*/
+template<typename T>
+void adjacency(const SparseMatrix<T>& A, vector<int>& start, vector<int>& index);
+
+/**
+  * @brief   Inverts a permutation
+  * @pre     perm must hold every index 0 .. n - 1 once
+  * @post    None
+  * @param   perm - perm[k] is the old row at position k
+  * @return  inverse[i] is the position of old row i
+  * @throw   If perm is not a permutation
+*/
+inline vector<int> inversePermutation(const vector<int>& perm);
+
+/**
+  * @brief   Nested dissection of an nx by ny five point grid numbered
+              y * nx + x. The longer side is cut by a line of points, both
+              halves are ordered the same way and the line goes last.
+  * @pre     nx and ny must be positive
+  * @post    None
+  * @param   nx - Points across
+  * @param   ny - Points down
+  * @return  The ordering
+  * @throw   If nx or ny is not positive
+*/
+inline vector<int> nestedDissection(const int nx, const int ny);
+
+/**
+  * @brief   Approximate minimum degree. Eliminated rows become elements of
+              a quotient graph, so the graph never grows. Each step takes
+              the row with the smallest bound on its degree, the AMD bound
+              |A_i| + |L_p \ i| + sum of |L_e \ L_p| over the other elements,
+              from lists bucketed by degree. Elements that fall inside L_p
+              are absorbed and rows that become indistinguishable are merged
+              into supervariables, eliminated together.
+  * @pre     A must be square, general storage must have a symmetric pattern
+  * @post    None
+  * @param   A - Matrix in symmetric or general storage
+  * @return  The ordering
+  * @throw   If A is not square
+*/
+template<typename T>
+vector<int> minimumDegree(const SparseMatrix<T>& A);
+
+/**
+  * @brief   Reverse Cuthill-McKee. Each connected piece starts from a
+              pseudo-peripheral row, found by restarting a breadth first
+              search from the deepest level until the depth stops growing.
+              Rows are then numbered level by level, neighbours of lower
+              degree first, and the whole order is reversed.
+  * @pre     A must be square, general storage is made symmetric
+  * @post    None
+  * @param   A - Matrix in symmetric or general storage
+  * @return  The ordering
+  * @throw   If A is not square
+*/
+template<typename T>
+vector<int> reverseCuthillMcKee(const SparseMatrix<T>& A);
+
+#include "./ordering.hpp"
+
+#endif
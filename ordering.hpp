@@ -0,0 +1,568 @@
+/**
+  * @file   ordering.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the fill reducing orderings
+*/
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template<typename T>
+void adjacency(const SparseMatrix<T>& A, vector<int>& start, vector<int>& index)
+{
+  if(A.getRow() != A.getCol())
+  {
+    std::cerr << "An ordering needs a square matrix" << std::endl;
+    throw std::out_of_range("NON SQUARE MATRIX; ORDERING");
+  }
+
+  const int n = A.getRow();
+  const int* rowStart = A.rowStart();
+  const int* cols = A.colIndex();
+
+  // Every off diagonal entry goes both ways, general storage then holds
+  // each edge twice and the copies are dropped below
+  start = vector<int>(n + 1);
+  int* s = start.data();
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      if(cols[k] != r)
+      {
+        s[r + 1]++;
+        s[cols[k] + 1]++;
+      }
+    }
+  }
+  for(int r = 0; r < n; r++)
+  {
+    s[r + 1] += s[r];
+  }
+
+  vector<int> fill(n);
+  vector<int> all(s[n] > 0 ? s[n] : 1);
+  int* f = fill.data();
+  int* a = all.data();
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      const int c = cols[k];
+      if(c != r)
+      {
+        a[s[r] + f[r]++] = c;
+        a[s[c] + f[c]++] = r;
+      }
+    }
+  }
+
+  vector<int> seen(n);
+  int* mark = seen.data();
+  for(int r = 0; r < n; r++)
+  {
+    mark[r] = -1;
+  }
+  int kept = 0;
+  for(int r = 0; r < n; r++)
+  {
+    const int first = s[r];
+    const int last = s[r + 1];
+    s[r] = kept;
+    for(int k = first; k < last; k++)
+    {
+      if(mark[a[k]] != r)
+      {
+        mark[a[k]] = r;
+        a[kept++] = a[k];
+      }
+    }
+  }
+  s[n] = kept;
+
+  index = vector<int>(kept > 0 ? kept : 1);
+  for(int k = 0; k < kept; k++)
+  {
+    index[k] = a[k];
+  }
+}
+
+inline vector<int> inversePermutation(const vector<int>& perm)
+{
+  const int n = perm.getSize();
+  vector<int> inverse(n);
+  for(int i = 0; i < n; i++)
+  {
+    inverse[i] = -1;
+  }
+  for(int k = 0; k < n; k++)
+  {
+    if(perm[k] < 0 || perm[k] >= n || inverse[perm[k]] != -1)
+    {
+      std::cerr << "Ordering is not a permutation" << std::endl;
+      throw std::out_of_range("BAD PERMUTATION; ORDERING");
+    }
+    inverse[perm[k]] = k;
+  }
+
+  return inverse;
+}
+
+/**
+  * @brief   Orders the x0 .. x1 - 1 by y0 .. y1 - 1 part of the grid,
+              halves first, then the line between them
+  * @pre     order has room from next on
+  * @post    next is past the points written
+  * @param   nx - Points across the whole grid
+  * @param   x0 - First column
+  * @param   x1 - One past the last column
+  * @param   y0 - First row
+  * @param   y1 - One past the last row
+  * @param   order - The ordering being built
+  * @param   next - Next position of order to fill
+  * @return  None
+*/
+inline void dissect(const int nx, const int x0, const int x1, const int y0, const int y1,
+                    int* order, int& next)
+{
+  const int width = x1 - x0;
+  const int height = y1 - y0;
+  if(width <= 0 || height <= 0)
+  {
+    return;
+  }
+
+  if(width < 3 && height < 3)
+  {
+    for(int y = y0; y < y1; y++)
+    {
+      for(int x = x0; x < x1; x++)
+      {
+        order[next++] = y * nx + x;
+      }
+    }
+    return;
+  }
+
+  if(width >= height)
+  {
+    const int mid = x0 + width / 2;
+    dissect(nx, x0, mid, y0, y1, order, next);
+    dissect(nx, mid + 1, x1, y0, y1, order, next);
+    for(int y = y0; y < y1; y++)
+    {
+      order[next++] = y * nx + mid;
+    }
+  }
+  else
+  {
+    const int mid = y0 + height / 2;
+    dissect(nx, x0, x1, y0, mid, order, next);
+    dissect(nx, x0, x1, mid + 1, y1, order, next);
+    for(int x = x0; x < x1; x++)
+    {
+      order[next++] = mid * nx + x;
+    }
+  }
+}
+
+inline vector<int> nestedDissection(const int nx, const int ny)
+{
+  if(nx <= 0 || ny <= 0)
+  {
+    std::cerr << "Grid sides must be positive" << std::endl;
+    throw std::out_of_range("BAD GRID SIZE; ORDERING");
+  }
+
+  vector<int> perm(nx * ny);
+  int next = 0;
+  dissect(nx, 0, nx, 0, ny, perm.data(), next);
+
+  return perm;
+}
+
+template<typename T>
+vector<int> minimumDegree(const SparseMatrix<T>& A)
+{
+  vector<int> start;
+  vector<int> index;
+  adjacency(A, start, index);
+  const int n = A.getRow();
+
+  // Row i is a variable until it is eliminated, then an element whose
+  // members are the variables it was joined to. vars[i] are the variables
+  // next to i, elems[i] the elements next to i. Variables with the same
+  // neighbours are merged into one supervariable of weight[i] rows, the
+  // rest of it hangs off i through chain.
+  enum { VARIABLE, ELEMENT, ABSORBED, MERGED };
+  std::vector<std::vector<int>> vars(n);
+  std::vector<std::vector<int>> elems(n);
+  std::vector<std::vector<int>> members(n);
+  std::vector<char> state(n, VARIABLE);
+  std::vector<int> weight(n, 1);
+  std::vector<int> chain(n, -1);
+  std::vector<int> chainLast(n);
+  // Weighted |L_e|, which only merging could change and merging keeps
+  std::vector<int> elemSize(n, 0);
+  std::vector<int> degree(n);
+  std::vector<int> mark(n, -1);
+  // |L_e \ L_p| for the elements met while eliminating p
+  std::vector<int> outside(n, 0);
+  std::vector<int> outsideStep(n, -1);
+  std::vector<unsigned long long> hash(n, 0);
+  // Stamps the lists of the variable others are compared with
+  std::vector<int> seen(n, -1);
+  int stamp = 0;
+
+  // Degree lists, head[d] starts the variables whose degree bound is d
+  std::vector<int> head(n + 1, -1);
+  std::vector<int> next(n, -1);
+  std::vector<int> prev(n, -1);
+  auto insert = [&](const int i)
+  {
+    const int d = degree[i];
+    next[i] = head[d];
+    prev[i] = -1;
+    if(head[d] >= 0)
+    {
+      prev[head[d]] = i;
+    }
+    head[d] = i;
+  };
+  auto remove = [&](const int i)
+  {
+    if(prev[i] >= 0)
+    {
+      next[prev[i]] = next[i];
+    }
+    else
+    {
+      head[degree[i]] = next[i];
+    }
+    if(next[i] >= 0)
+    {
+      prev[next[i]] = prev[i];
+    }
+  };
+
+  for(int i = 0; i < n; i++)
+  {
+    vars[i].assign(index.data() + start[i], index.data() + start[i + 1]);
+    degree[i] = start[i + 1] - start[i];
+    chainLast[i] = i;
+    insert(i);
+  }
+
+  vector<int> perm(n);
+  std::vector<int> joined;
+  std::vector<std::pair<unsigned long long, int>> byHash;
+  int done = 0;
+  int minDegree = 0;
+  for(int step = 0; done < n; step++)
+  {
+    while(head[minDegree] < 0)
+    {
+      minDegree++;
+    }
+    const int p = head[minDegree];
+    remove(p);
+    state[p] = ELEMENT;
+    for(int j = p; j >= 0; j = chain[j])
+    {
+      perm[done++] = j;
+    }
+
+    // L_p, every variable p reaches directly or through an element. The
+    // elements passed through are all inside L_p now, so p absorbs them.
+    joined.clear();
+    int size = 0;
+    mark[p] = step;
+    auto join = [&](const int j)
+    {
+      if(state[j] == VARIABLE && mark[j] != step)
+      {
+        mark[j] = step;
+        joined.push_back(j);
+        size += weight[j];
+      }
+    };
+    for(const int j : vars[p])
+    {
+      join(j);
+    }
+    for(const int e : elems[p])
+    {
+      if(state[e] != ELEMENT)
+      {
+        continue;
+      }
+      for(const int j : members[e])
+      {
+        join(j);
+      }
+      state[e] = ABSORBED;
+      std::vector<int>().swap(members[e]);
+    }
+    std::vector<int>().swap(vars[p]);
+    std::vector<int>().swap(elems[p]);
+    elemSize[p] = size;
+
+    // outside[e] ends as |L_e \ L_p| for every other element next to L_p
+    for(const int i : joined)
+    {
+      remove(i);
+      for(const int e : elems[i])
+      {
+        if(state[e] == ELEMENT)
+        {
+          if(outsideStep[e] != step)
+          {
+            outsideStep[e] = step;
+            outside[e] = elemSize[e];
+          }
+          outside[e] -= weight[i];
+        }
+      }
+    }
+
+    // Prune the lists of every i in L_p and bound its external degree by
+    // |A_i| + |L_p \ i| + sum of |L_e \ L_p| over its other elements.
+    // Elements with nothing outside L_p are absorbed by p.
+    const int left = n - done;
+    for(const int i : joined)
+    {
+      unsigned long long key = static_cast<unsigned long long>(p);
+      std::vector<int>& ei = elems[i];
+      int bound = size - weight[i];
+      int kept = 0;
+      for(const int e : ei)
+      {
+        if(state[e] != ELEMENT)
+        {
+          continue;
+        }
+        if(outside[e] == 0)
+        {
+          state[e] = ABSORBED;
+          std::vector<int>().swap(members[e]);
+          continue;
+        }
+        ei[kept++] = e;
+        bound += outside[e];
+        key += static_cast<unsigned long long>(e);
+      }
+      ei.resize(kept);
+      ei.push_back(p);
+
+      // A variable that is in L_p is now reached through p
+      std::vector<int>& vi = vars[i];
+      kept = 0;
+      for(const int j : vi)
+      {
+        if(state[j] == VARIABLE && mark[j] != step)
+        {
+          vi[kept++] = j;
+          bound += weight[j];
+          key += static_cast<unsigned long long>(j);
+        }
+      }
+      vi.resize(kept);
+
+      const int most = left - weight[i];
+      degree[i] = (bound < most ? bound : most);
+      hash[i] = key;
+    }
+
+    // Variables of L_p with the same elements and variables can never be
+    // told apart again, one of them stands in for the rest
+    byHash.clear();
+    for(const int i : joined)
+    {
+      byHash.emplace_back(hash[i], i);
+    }
+    std::sort(byHash.begin(), byHash.end());
+    for(std::size_t a = 0; a < byHash.size(); a++)
+    {
+      const int i = byHash[a].second;
+      if(state[i] != VARIABLE)
+      {
+        continue;
+      }
+      bool stamped = false;
+      for(std::size_t b = a + 1; b < byHash.size() && byHash[b].first == byHash[a].first; b++)
+      {
+        const int j = byHash[b].second;
+        if(state[j] != VARIABLE || elems[j].size() != elems[i].size()
+           || vars[j].size() != vars[i].size())
+        {
+          continue;
+        }
+        if(!stamped)
+        {
+          stamp++;
+          for(const int e : elems[i])
+          {
+            seen[e] = stamp;
+          }
+          for(const int k : vars[i])
+          {
+            seen[k] = stamp;
+          }
+          stamped = true;
+        }
+        bool same = true;
+        for(const int e : elems[j])
+        {
+          same = same && seen[e] == stamp;
+        }
+        for(const int k : vars[j])
+        {
+          same = same && seen[k] == stamp;
+        }
+        if(!same)
+        {
+          continue;
+        }
+
+        degree[i] -= weight[j];
+        weight[i] += weight[j];
+        weight[j] = 0;
+        state[j] = MERGED;
+        chain[chainLast[i]] = j;
+        chainLast[i] = chainLast[j];
+        std::vector<int>().swap(vars[j]);
+        std::vector<int>().swap(elems[j]);
+      }
+    }
+
+    // Keep only the variables that still stand for themselves in L_p
+    std::vector<int>& lp = members[p];
+    lp.reserve(joined.size());
+    for(const int i : joined)
+    {
+      if(state[i] == VARIABLE)
+      {
+        lp.push_back(i);
+        degree[i] = (degree[i] > 0 ? degree[i] : 0);
+        insert(i);
+        minDegree = (degree[i] < minDegree ? degree[i] : minDegree);
+      }
+    }
+  }
+
+  return perm;
+}
+
+template<typename T>
+vector<int> reverseCuthillMcKee(const SparseMatrix<T>& A)
+{
+  vector<int> start;
+  vector<int> index;
+  adjacency(A, start, index);
+  const int n = A.getRow();
+  const int* s = start.data();
+  const int* adj = index.data();
+  auto degree = [&](const int i) { return s[i + 1] - s[i]; };
+
+  std::vector<char> numbered(n, 0);
+  std::vector<int> seen(n, -1);
+  std::vector<int> queue(n);
+  int search = 0;
+
+  // Breadth first search over rows not numbered yet. Returns the depth and
+  // leaves the deepest level at queue[deepest .. end).
+  auto levels = [&](const int root, int& deepest, int& end)
+  {
+    search++;
+    seen[root] = search;
+    queue[0] = root;
+    int head = 0;
+    end = 1;
+    int depth = 0;
+    deepest = 0;
+    while(head < end)
+    {
+      const int levelEnd = end;
+      deepest = head;
+      for(; head < levelEnd; head++)
+      {
+        const int v = queue[head];
+        for(int k = s[v]; k < s[v + 1]; k++)
+        {
+          const int w = adj[k];
+          if(!numbered[w] && seen[w] != search)
+          {
+            seen[w] = search;
+            queue[end++] = w;
+          }
+        }
+      }
+      depth++;
+    }
+    return depth;
+  };
+
+  vector<int> perm(n);
+  int next = 0;
+  for(int first = 0; first < n; first++)
+  {
+    if(numbered[first])
+    {
+      continue;
+    }
+
+    // Lowest degree row of this piece, then deeper roots while they help
+    int deepest = 0;
+    int end = 0;
+    levels(first, deepest, end);
+    int root = first;
+    for(int q = 0; q < end; q++)
+    {
+      root = (degree(queue[q]) < degree(root) ? queue[q] : root);
+    }
+    int depth = levels(root, deepest, end);
+    while(true)
+    {
+      int candidate = queue[deepest];
+      for(int q = deepest; q < end; q++)
+      {
+        candidate = (degree(queue[q]) < degree(candidate) ? queue[q] : candidate);
+      }
+      const int candidateDepth = levels(candidate, deepest, end);
+      if(candidateDepth <= depth)
+      {
+        break;
+      }
+      root = candidate;
+      depth = candidateDepth;
+    }
+
+    // Cuthill-McKee from root, each row's new neighbours by rising degree
+    const int pieceStart = next;
+    perm[next++] = root;
+    numbered[root] = 1;
+    for(int head = pieceStart; head < next; head++)
+    {
+      const int v = perm[head];
+      const int added = next;
+      for(int k = s[v]; k < s[v + 1]; k++)
+      {
+        const int w = adj[k];
+        if(!numbered[w])
+        {
+          numbered[w] = 1;
+          perm[next++] = w;
+        }
+      }
+      std::sort(perm.data() + added, perm.data() + next, [&](const int a, const int b)
+      {
+        return (degree(a) != degree(b) ? degree(a) < degree(b) : a < b);
+      });
+    }
+  }
+
+  std::reverse(perm.data(), perm.data() + n);
+
+  return perm;
+}
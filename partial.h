@@ -13,10 +13,41 @@
 
 #include <iostream>
 #include <cstddef>
+#include <functional>
+#include <type_traits>
 #include "vector.h"
+#include "sparse.h"
+#include "band.h"
+#include "skyline.h"
+#include "dense.h"
+#include "poisson.h"
 
 using FunctPtr = double(*)(double);
 using ForcedFunct = double(*)(double, double);
+/** Fills out[i] = u(x[i]) for count points of one boundary edge */
+using BoundaryBatch = std::function<void(const double* x, double* out, int count)>;
+/** Fills out[i] = f(x[i], y[i]) for count mesh points */
+using ForcedBatch = std::function<void(const double* x, const double* y, double* out, int count)>;
+/** Only lets callables that take one point at a time through */
+template <class XUpper, class XLower, class YUpper, class YLower, class Force>
+using PointFunctions = std::enable_if_t<std::is_invocable_r_v<double, XUpper, double>
+  && std::is_invocable_r_v<double, XLower, double> && std::is_invocable_r_v<double, YUpper, double>
+  && std::is_invocable_r_v<double, YLower, double> && std::is_invocable_r_v<double, Force, double, double>>;
+
+/** Which solver PartialDiff hands the system to. 0 and 1 match the old bool. */
+enum SolverType
+{
+  GAUSSIAN = 0,
+  CHOLESKY = 1,
+  CONJUGATE_GRADIENT = 2,
+  MULTIGRID = 3,
+  FAST_POISSON = 4,
+  SOR = 5,
+  SPARSE_CHOLESKY = 6
+};
+
+template <class T>
+class FastPoissonSolver;
 
 template <class T>
 class PartialDiff
@@ -24,6 +55,74 @@ class PartialDiff
   private:
     T upperBound;
     T lowerBound;
+    /**
+      * @brief   Walks the five point stencil of every mesh interior point
+      * @pre     partitions must be greater than one
+      * @post    None
+      * @param   partitions - Our N.
+      * @param   entry - Called as entry(col, row, value) for every non zero of
+                  the matrix, rows in order and cols ascending within a row
+      * @return  None
+    */
+    template <class Entry>
+    void stencil(const int partitions, Entry entry) const;
+    /**
+      * @brief   Hands B to the chosen solver
+      * @pre     B must come from makeRHS with the same partitions
+      * @post    None
+      * @param   B - The right hand side
+      * @param   partitions - Our N.
+      * @param   solver - Which SolverType is used
+      * @return  The real x vector values
+      * @throw   If the solver type is unknown
+    */
+    vector<T> solve(const vector<T>& B, const int partitions, const int solver) const;
+    /**
+      * @brief   Hands every column of B to the chosen solver. Gaussian and
+                  both Choleskys factor once for all of them, the sine transform
+                  solver is planned once and iterative solvers run per column.
+      * @pre     Every column of B must come from makeRHS with the same partitions
+      * @post    None
+      * @param   B - One right hand side per column
+      * @param   partitions - Our N.
+      * @param   solver - Which SolverType is used
+      * @return  One solution per column
+      * @throw   If the solver type is unknown
+    */
+    DenseMatrix<T> solve(const DenseMatrix<T>& B, const int partitions, const int solver) const;
+    /**
+      * @brief   Wraps a point at a time function as a batch one
+      * @pre     f must not be null
+      * @post    None
+      * @param   f - Function to call for every point
+      * @return  The batch function
+    */
+    static BoundaryBatch batch(const FunctPtr f);
+    static ForcedBatch batch(const ForcedFunct f);
+    /**
+      * @brief   Gets the interior coordinates of one grid line
+      * @pre     partitions must be greater than one
+      * @post    None
+      * @param   partitions - Our N.
+      * @return  lower + i h for i = 1 ... N-1, the same along x and y
+    */
+    vector<double> meshPoints(const int partitions) const;
+    /**
+      * @brief   Turns the forcing grid into B, scaling it by h^2 / 4 and adding
+                  1/4 of every boundary neighbour
+      * @pre     BVec holds f at every mesh point, the edges hold N-1 values
+      * @post    BVec is the right hand side
+      * @param   BVec - Forcing values, then B
+      * @param   xUpperVals - u(x, UPPER) along the edge
+      * @param   xLowerVals - u(x, LOWER) along the edge
+      * @param   yUpperVals - u(UPPER, y) along the edge
+      * @param   yLowerVals - u(LOWER, y) along the edge
+      * @param   partitions - Our N.
+      * @return  None
+    */
+    void foldEdges(vector<double>& BVec, const vector<double>& xUpperVals,
+          const vector<double>& xLowerVals, const vector<double>& yUpperVals,
+          const vector<double>& yLowerVals, const int partitions) const;
   public:
     /**
       * @brief   Confirms LowerTriangle row and col are proper values
@@ -46,13 +145,168 @@ class PartialDiff
       * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
       * @param   Forced - The forced function; f(x, y)
       * @param   partitions - Our N.
-      * @param   choleskySolver - Determines if choleski or if Gaussian is used.
+      * @param   solver - Which SolverType is used, the sine transform solver
+                  by default.
       * @return  The real x vector values
       * @throw   If none of the function ptrs are passed in.
     */
     vector<T> operator()(const FunctPtr UpperBound = NULL, const FunctPtr LowerBound = NULL, 
           const FunctPtr LeftBound = NULL, const FunctPtr RightBound = NULL,  const ForcedFunct Forced = NULL,
-          const int partitions = 0, const bool choleskySolver = 1) const;
+          const int partitions = 0, const int solver = FAST_POISSON) const;
+    /**
+      * @brief   Generates the X vector, each boundary edge and the forcing grid
+                  are asked for in one batch call
+      * @pre     All functions must be passed in.
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced function; f(x, y)
+      * @param   partitions - Our N.
+      * @param   solver - Which SolverType is used, the sine transform solver
+                  by default.
+      * @return  The real x vector values
+      * @throw   If any function is missing or partitions is less than 2
+    */
+    vector<T> operator()(const BoundaryBatch& UpperBound, const BoundaryBatch& LowerBound,
+          const BoundaryBatch& LeftBound, const BoundaryBatch& RightBound,
+          const ForcedBatch& Forced, const int partitions,
+          const int solver = FAST_POISSON) const;
+    /**
+      * @brief   Generates the X vector from any callables, such as lambdas or
+                  functors, called directly so they can be inlined
+      * @pre     The bounds take a double and Forced two, all return double
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced function; f(x, y)
+      * @param   partitions - Our N.
+      * @param   solver - Which SolverType is used, the sine transform solver
+                  by default.
+      * @return  The real x vector values
+      * @throw   If partitions is less than 2
+    */
+    template <class XUpper, class XLower, class YUpper, class YLower, class Force,
+              class = PointFunctions<XUpper, XLower, YUpper, YLower, Force>>
+    vector<T> operator()(XUpper UpperBound, XLower LowerBound, YUpper LeftBound,
+          YLower RightBound, Force Forced, const int partitions,
+          const int solver = FAST_POISSON) const;
+    /**
+      * @brief   Solves one grid and boundary for several forcing functions,
+                  the matrix is only factored once for all of them
+      * @pre     Forced must hold at least one function
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced functions; f(x, y)
+      * @param   partitions - Our N.
+      * @param   solver - Which SolverType is used, the sine transform solver
+                  by default.
+      * @return  Column c holds the x vector for Forced[c]
+      * @throw   If partitions is invalid or the solver type is unknown
+    */
+    DenseMatrix<T> operator()(const FunctPtr UpperBound, const FunctPtr LowerBound,
+          const FunctPtr LeftBound, const FunctPtr RightBound,
+          const vector<ForcedFunct>& Forced, const int partitions,
+          const int solver = FAST_POISSON) const;
+    /**
+      * @brief   Generates the B vector for the correlating mesh interior points
+      * @pre     All function pointers must be passed in.
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced function; f(x, y)
+      * @param   partitions - Our N.
+      * @return  The (N-1)^2 right hand side, boundary values and forcing included
+      * @throw   If any function ptr is missing or partitions is less than 2
+    */
+    vector<T> makeRHS(const FunctPtr UpperBound, const FunctPtr LowerBound,
+          const FunctPtr LeftBound, const FunctPtr RightBound, const ForcedFunct Forced,
+          const int partitions) const;
+    /**
+      * @brief   Generates the B vector from batch functions, called once per
+                  boundary edge and once for the whole forcing grid
+      * @pre     All functions must be passed in.
+      * @post    None
+      * @param   UpperBound - Edge u(UPPER, y) at count y values
+      * @param   LowerBound - Edge u(LOWER, y) at count y values
+      * @param   LeftBound - Edge u(x, UPPER) at count x values
+      * @param   RightBound - Edge u(x, LOWER) at count x values
+      * @param   Forced - f(x, y) at count mesh points
+      * @param   partitions - Our N.
+      * @return  The (N-1)^2 right hand side, boundary values and forcing included
+      * @throw   If any function is missing or partitions is less than 2
+    */
+    vector<T> makeRHS(const BoundaryBatch& UpperBound, const BoundaryBatch& LowerBound,
+          const BoundaryBatch& LeftBound, const BoundaryBatch& RightBound,
+          const ForcedBatch& Forced, const int partitions) const;
+    /**
+      * @brief   Generates the B vector from any callables, called directly so
+                  they can be inlined into the loops
+      * @pre     The bounds take a double and Forced two, all return double
+      * @post    None
+      * @param   UpperBound - This is when x is equal to the upper bound; u(UPPER, y)
+      * @param   LowerBound - When x is equal to the lower bound; u(LOWER, y)
+      * @param   LeftBound - When y is equal to upper bound; u(x, UPPER)
+      * @param   RightBound - When y is equal to lower bound; u(x, LOWER)
+      * @param   Forced - The forced function; f(x, y)
+      * @param   partitions - Our N.
+      * @return  The (N-1)^2 right hand side, boundary values and forcing included
+      * @throw   If partitions is less than 2
+    */
+    template <class XUpper, class XLower, class YUpper, class YLower, class Force,
+              class = PointFunctions<XUpper, XLower, YUpper, YLower, Force>>
+    vector<T> makeRHS(XUpper UpperBound, XLower LowerBound, YUpper LeftBound,
+          YLower RightBound, Force Forced, const int partitions) const;
+    /**
+      * @brief   Assembles the (N-1)^2 five point matrix straight into CSR
+                  storage, about 5 entries a row instead of (N-1)^2
+      * @pre     None
+      * @post    None
+      * @param   partitions - Our N.
+      * @param   symmetric - Only keep the lower triangle
+      * @return  The A matrix of the system
+      * @throw   If partitions is less than 2
+    */
+    SparseMatrix<T> makeSparse(const int partitions, const bool symmetric = true) const;
+    /**
+      * @brief   Assembles the (N-1)^2 five point matrix into band storage with
+                  a half bandwidth of N-1, ready for band Cholesky
+      * @pre     None
+      * @post    None
+      * @param   partitions - Our N.
+      * @return  The A matrix of the system
+      * @throw   If partitions is less than 2
+    */
+    BandSymMatrix<T> makeBand(const int partitions) const;
+    /**
+      * @brief   Assembles the (N-1)^2 five point matrix into skyline storage,
+                  each row starting at its furthest neighbour back, ready for
+                  profile Cholesky
+      * @pre     None
+      * @post    None
+      * @param   partitions - Our N.
+      * @return  The A matrix of the system
+      * @throw   If partitions is less than 2
+    */
+    SkylineSymMatrix<T> makeSkyline(const int partitions) const;
+    /**
+      * @brief   Makes the matrix free five point operator for the mesh, A is
+                  never stored so only iterative solvers can use it
+      * @pre     None
+      * @post    None
+      * @param   partitions - Our N.
+      * @return  The A operator of the system, pair it with makeRHS
+      * @throw   If partitions is less than 2
+    */
+    PoissonOperator<T> makeOperator(const int partitions) const { return PoissonOperator<T>(partitions); }
 
 };
 
@@ -9,6 +9,14 @@
 #include "partial.h"
 #include "dense.h"
 #include "solver.h"
+#include "sparse.h"
+#include "band.h"
+#include "skyline.h"
+#include "conjugate.h"
+#include "multigrid.h"
+#include "fastpoisson.h"
+#include "sparsecholesky.h"
+#include "sor.h"
 
 template <typename T>
 PartialDiff<T>::PartialDiff(const T lower, const T upper)
@@ -23,114 +31,507 @@ PartialDiff<T>::PartialDiff(const T lower, const T upper)
 }
 
 template <typename T>
-vector<T> PartialDiff<T>::operator()(const FunctPtr xUpper, const FunctPtr xLower, 
+template <class Entry>
+void PartialDiff<T>::stencil(const int partitions, Entry entry) const
+{
+  // Interior points along one grid line
+  const int LINE = partitions-1;
+
+  // Interior points are numbered x first, so u(xj, yk) is row (k-1)*(N-1) + (j-1).
+  // Its x neighbours are one row away and its y neighbours one grid line away,
+  // and a neighbour is on the boundary exactly when j or k is 1 or N-1.
+  int row = 0;
+  for(int y = 1; y < partitions; y++)
+  {
+    for(int x = 1; x < partitions; x++)
+    {
+      // u(xj, yk-1)
+      if(y != 1)
+      {
+        entry(row-LINE, row, -0.25);
+      }
+      // u(xj-1, yk)
+      if(x != 1)
+      {
+        entry(row-1, row, -0.25);
+      }
+      entry(row, row, 1);
+      // u(xj+1, yk)
+      if(x != LINE)
+      {
+        entry(row+1, row, -0.25);
+      }
+      // u(xj, yk+1)
+      if(y != LINE)
+      {
+        entry(row+LINE, row, -0.25);
+      }
+
+      row++;
+    }
+  }
+}
+
+template <typename T>
+vector<T> PartialDiff<T>::makeRHS(const FunctPtr xUpper, const FunctPtr xLower,
                     const FunctPtr yUpper, const FunctPtr yLower, const ForcedFunct Forced,
-                    const int partitions, const bool choleskySolver) const 
+                    const int partitions) const
 {
-  if(xUpper == NULL || xLower == NULL || yUpper == NULL || yLower == NULL)
+  if(xUpper == NULL || xLower == NULL || yUpper == NULL || yLower == NULL || Forced == NULL)
   {
     std::cout << "Missing bound function" << std::endl;
     throw std::out_of_range("Someone forgot to pass a bound function tsk tsk");
   }
-  if(partitions <= 0)
+
+  return makeRHS(batch(xUpper), batch(xLower), batch(yUpper), batch(yLower),
+                 batch(Forced), partitions);
+}
+
+template <typename T>
+vector<T> PartialDiff<T>::makeRHS(const BoundaryBatch& xUpper, const BoundaryBatch& xLower,
+                    const BoundaryBatch& yUpper, const BoundaryBatch& yLower,
+                    const ForcedBatch& Forced, const int partitions) const
+{
+  if(!xUpper || !xLower || !yUpper || !yLower || !Forced)
+  {
+    std::cout << "Missing bound function" << std::endl;
+    throw std::out_of_range("Someone forgot to pass a bound function tsk tsk");
+  }
+  if(partitions <= 1)
   {
     throw std::out_of_range("Invalid partition size given");
   }
   // (N-1)^2
   const int SIZE = (partitions-1)*(partitions-1);
+  const int LINE = partitions-1;
 
-  DenseMatrix<double> AMatrix(SIZE, SIZE);
-  vector<Point> XVec(SIZE);
+  const vector<double> pos = meshPoints(partitions);
+
+  // Every edge and the whole forcing grid in one call each
+  vector<double> xUpperVals(LINE);
+  vector<double> xLowerVals(LINE);
+  vector<double> yUpperVals(LINE);
+  vector<double> yLowerVals(LINE);
+  xUpper(pos.data(), xUpperVals.data(), LINE);
+  xLower(pos.data(), xLowerVals.data(), LINE);
+  yUpper(pos.data(), yUpperVals.data(), LINE);
+  yLower(pos.data(), yLowerVals.data(), LINE);
+
+  vector<double> xGrid(SIZE);
+  vector<double> yGrid(SIZE);
+  for(int y = 0; y < LINE; y++)
+  {
+    for(int x = 0; x < LINE; x++)
+    {
+      xGrid[y*LINE + x] = pos[x];
+      yGrid[y*LINE + x] = pos[y];
+    }
+  }
   vector<double> BVec(SIZE);
-  vector<double> FVec(SIZE);
+  Forced(xGrid.data(), yGrid.data(), BVec.data(), SIZE);
 
-  // All the x and y shifted points. "Main" is just u(xj, yk)
-  vector<Point> notMain(4);
-  
-  const double FRACT = static_cast<double>(upperBound - lowerBound) / partitions;
+  foldEdges(BVec, xUpperVals, xLowerVals, yUpperVals, yLowerVals, partitions);
+  return BVec;
+}
 
-  // Make vector X
-  int index = 0;
-  for(int y = 1; y < partitions; y++)
+template <typename T>
+template <class XUpper, class XLower, class YUpper, class YLower, class Force, class>
+vector<T> PartialDiff<T>::makeRHS(XUpper xUpper, XLower xLower, YUpper yUpper,
+                    YLower yLower, Force Forced, const int partitions) const
+{
+  if(partitions <= 1)
   {
-    for(int x = 1; x < partitions; x++)
+    throw std::out_of_range("Invalid partition size given");
+  }
+  const int LINE = partitions-1;
+
+  const vector<double> pos = meshPoints(partitions);
+  const double* p = pos.data();
+
+  vector<double> xUpperVals(LINE);
+  vector<double> xLowerVals(LINE);
+  vector<double> yUpperVals(LINE);
+  vector<double> yLowerVals(LINE);
+  for(int i = 0; i < LINE; i++)
+  {
+    xUpperVals[i] = xUpper(p[i]);
+    xLowerVals[i] = xLower(p[i]);
+    yUpperVals[i] = yUpper(p[i]);
+    yLowerVals[i] = yLower(p[i]);
+  }
+
+  // The calls are direct here, so a closed form forcing term inlines
+  vector<double> BVec(LINE*LINE);
+  double* b = BVec.data();
+  for(int y = 0; y < LINE; y++)
+  {
+    const double yPos = p[y];
+    double* by = b + y*LINE;
+    for(int x = 0; x < LINE; x++)
     {
-      XVec[index] = Point(x*FRACT, y*FRACT);
-      index++;
+      by[x] = Forced(p[x], yPos);
     }
   }
 
-  // Determine rows for matrix
-  int row = 0;
+  foldEdges(BVec, xUpperVals, xLowerVals, yUpperVals, yLowerVals, partitions);
+  return BVec;
+}
+
+template <typename T>
+vector<double> PartialDiff<T>::meshPoints(const int partitions) const
+{
+  const int LINE = partitions-1;
+  const double FRACT = static_cast<double>(upperBound - lowerBound) / partitions;
+
+  // The interior coordinates are the same along x and y
+  vector<double> pos(LINE);
+  for(int i = 0; i < LINE; i++)
+  {
+    pos[i] = lowerBound + (i+1)*FRACT;
+  }
+
+  return pos;
+}
+
+template <typename T>
+void PartialDiff<T>::foldEdges(vector<double>& BVec, const vector<double>& xUpperVals,
+                    const vector<double>& xLowerVals, const vector<double>& yUpperVals,
+                    const vector<double>& yLowerVals, const int partitions) const
+{
+  const int LINE = partitions-1;
+  const double FRACT = static_cast<double>(upperBound - lowerBound) / partitions;
+  const double SCALE = (FRACT * FRACT)/4.0;
+  double* b = BVec.data();
+  for(int i = 0; i < LINE*LINE; i++)
+  {
+    b[i] *= SCALE;
+  }
+
+  // Same numbering as stencil(), only the neighbours on the boundary add to B,
+  // so the lines between the first and last only have their two ends visited.
   for(int y = 1; y < partitions; y++)
   {
-    for(int x = 1; x < partitions; x++)
+    const int step = ((y == 1 || y == LINE || LINE == 1) ? 1 : LINE-1);
+    for(int x = 1; x < partitions; x += step)
     {
-      // Generate all the u() - 1/n [u()..... + u()] crap
-      const Point mainPoint(x*FRACT, y*FRACT);
-      notMain[0] = Point((x-1)*FRACT, y*FRACT);
-      notMain[1] = Point((x+1)*FRACT, y*FRACT);
-      notMain[2] = Point(x*FRACT, (y-1)*FRACT);
-      notMain[3] = Point(x*FRACT, (y+1)*FRACT);
-
-      // Loop over the other points from the formula and find what index they belong to.
-      // -1/n[u() + .... u()] points will just be -1/partitions
-      for(int i = 0; i < SIZE; i++)
+      const int row = (y-1)*LINE + (x-1);
+      double edge = 0;
+      // u(xj-1, yk)
+      if(x == 1)
       {
-        if(mainPoint == XVec[i])
-        {
-          AMatrix[i][row] = 1;
-          break;
-        }
+        edge += yLowerVals[y-1];
       }
-
-      for(int i = 0; i < 4; i++)
+      // u(xj+1, yk)
+      if(x == LINE)
+      {
+        edge += yUpperVals[y-1];
+      }
+      // u(xj, yk-1)
+      if(y == 1)
+      {
+        edge += xLowerVals[x-1];
+      }
+      // u(xj, yk+1)
+      if(y == LINE)
       {
-        for(int j = 0; j < SIZE; j++)
-        {
-          FVec[i] += (*Forced)(notMain[i].m_x, notMain[i].m_y);
-          if(notMain[i] == XVec[j])
-          {
-            AMatrix[j][row] = -0.25;
-            break;
-          }
-          else if(notMain[i].m_x == lowerBound)
-          {
-            BVec[row] += (*yLower)(notMain[i].m_y);
-            break;
-          }
-          else if(notMain[i].m_y == lowerBound)
-          {
-            BVec[row] += (*xLower)(notMain[i].m_x);
-            break;
-          }
-          else if(notMain[i].m_y == upperBound)
-          {
-            BVec[row] += (*xUpper)(notMain[i].m_x);
-            break;
-          }
-          else if(notMain[i].m_x == upperBound)
-          {
-            BVec[row] += (*yUpper)(notMain[i].m_y);
-            break;
-          }
-        }
+        edge += xUpperVals[x-1];
       }
 
-      row++;
+      b[row] = edge * 0.25 + b[row];
+    }
+  }
+}
+
+template <typename T>
+BoundaryBatch PartialDiff<T>::batch(const FunctPtr f)
+{
+  return [f](const double* x, double* out, const int count)
+  {
+    for(int i = 0; i < count; i++)
+    {
+      out[i] = (*f)(x[i]);
+    }
+  };
+}
+
+template <typename T>
+ForcedBatch PartialDiff<T>::batch(const ForcedFunct f)
+{
+  return [f](const double* x, const double* y, double* out, const int count)
+  {
+    for(int i = 0; i < count; i++)
+    {
+      out[i] = (*f)(x[i], y[i]);
     }
+  };
+}
+
+template <typename T>
+SparseMatrix<T> PartialDiff<T>::makeSparse(const int partitions, const bool symmetric) const
+{
+  if(partitions <= 1)
+  {
+    throw std::out_of_range("Invalid partition size given");
   }
+  const int SIZE = (partitions-1)*(partitions-1);
+
+  // At most five entries a row, three when only the lower half is kept.
+  SparseMatrix<T> AMatrix(SIZE, SIZE, (symmetric ? 3 : 5) * SIZE, symmetric);
+  int lastRow = 0;
+
+  stencil(partitions, [&](const int col, const int row, const T value)
+  {
+    if(row != lastRow)
+    {
+      AMatrix.closeRow();
+      lastRow = row;
+    }
+    if(!symmetric || col <= row)
+    {
+      AMatrix.append(col, value);
+    }
+  });
+  AMatrix.closeRow();
+
+  return AMatrix;
+}
 
-  BVec = BVec * 0.25;
-  FVec = FVec * ((partitions * partitions)/4.0);
-  BVec = BVec + FVec;
-  
-  GaussianSolver<double> solver;
+template <typename T>
+BandSymMatrix<T> PartialDiff<T>::makeBand(const int partitions) const
+{
+  if(partitions <= 1)
+  {
+    throw std::out_of_range("Invalid partition size given");
+  }
+  const int SIZE = (partitions-1)*(partitions-1);
+
+  // The furthest neighbour, u(xj, yk-1), is one grid line of N-1 points back.
+  BandSymMatrix<T> AMatrix(SIZE, partitions-1);
+
+  stencil(partitions, [&](const int col, const int row, const T value)
+  {
+    if(col <= row)
+    {
+      AMatrix(col, row) = value;
+    }
+  });
+
+  return AMatrix;
+}
+
+template <typename T>
+SkylineSymMatrix<T> PartialDiff<T>::makeSkyline(const int partitions) const
+{
+  if(partitions <= 1)
+  {
+    throw std::out_of_range("Invalid partition size given");
+  }
+  const int SIZE = (partitions-1)*(partitions-1);
+
+  // The envelope is read off the stencil itself, nothing assumes how far
+  // back the neighbours are
+  vector<int> first(SIZE);
+  for(int i = 0; i < SIZE; i++)
+  {
+    first[i] = i;
+  }
+  stencil(partitions, [&](const int col, const int row, const T)
+  {
+    first[row] = (col < first[row] ? col : first[row]);
+  });
+
+  SkylineSymMatrix<T> AMatrix(first);
+
+  stencil(partitions, [&](const int col, const int row, const T value)
+  {
+    if(col <= row)
+    {
+      AMatrix(col, row) = value;
+    }
+  });
+
+  return AMatrix;
+}
+
+template <typename T>
+vector<T> PartialDiff<T>::operator()(const FunctPtr xUpper, const FunctPtr xLower, 
+                    const FunctPtr yUpper, const FunctPtr yLower, const ForcedFunct Forced,
+                    const int partitions, const int solver) const 
+{
+  return solve(makeRHS(xUpper, xLower, yUpper, yLower, Forced, partitions),
+               partitions, solver);
+}
+
+template <typename T>
+vector<T> PartialDiff<T>::operator()(const BoundaryBatch& xUpper, const BoundaryBatch& xLower,
+                    const BoundaryBatch& yUpper, const BoundaryBatch& yLower,
+                    const ForcedBatch& Forced, const int partitions, const int solver) const
+{
+  return solve(makeRHS(xUpper, xLower, yUpper, yLower, Forced, partitions),
+               partitions, solver);
+}
+
+template <typename T>
+template <class XUpper, class XLower, class YUpper, class YLower, class Force, class>
+vector<T> PartialDiff<T>::operator()(XUpper xUpper, XLower xLower, YUpper yUpper,
+                    YLower yLower, Force Forced, const int partitions, const int solver) const
+{
+  return solve(makeRHS(xUpper, xLower, yUpper, yLower, Forced, partitions),
+               partitions, solver);
+}
+
+template <typename T>
+DenseMatrix<T> PartialDiff<T>::operator()(const FunctPtr xUpper, const FunctPtr xLower,
+                    const FunctPtr yUpper, const FunctPtr yLower,
+                    const vector<ForcedFunct>& Forced, const int partitions,
+                    const int solver) const
+{
+  if(partitions <= 1)
+  {
+    throw std::out_of_range("Invalid partition size given");
+  }
+
+  DenseMatrix<T> B((partitions-1)*(partitions-1), Forced.getSize());
+  for(int c = 0; c < Forced.getSize(); c++)
+  {
+    B[c] = makeRHS(xUpper, xLower, yUpper, yLower, Forced[c], partitions);
+  }
+
+  return solve(B, partitions, solver);
+}
+
+template <typename T>
+vector<T> PartialDiff<T>::solve(const vector<T>& BVec, const int partitions,
+                                const int solver) const
+{
+  const int SIZE = BVec.getSize();
+
+  if(solver == FAST_POISSON)
+  {
+    FastPoissonSolver<T> fast(lowerBound, upperBound);
+    return fast(makeOperator(partitions), BVec);
+  }
+
+  if(solver == CONJUGATE_GRADIENT)
+  {
+    // A is never stored. Jacobi is the identity here since A(i, i) = 1, and
+    // IC(0)/SSOR cut the iterations but their triangular sweeps cost more.
+    ConjugateGradientSolver<double> cg;
+    vector<double> x = cg(makeOperator(partitions), BVec);
+    if(!cg.converged())
+    {
+      std::cerr << "CG stopped after " << cg.getIterations() << " iterations with"
+                << " residual " << cg.getResidual() << std::endl;
+    }
+    return x;
+  }
+
+  if(solver == MULTIGRID)
+  {
+    MultigridSolver<double> mg;
+    vector<double> x = mg(makeOperator(partitions), BVec);
+    if(!mg.converged())
+    {
+      std::cerr << "Multigrid stopped after " << mg.getCycles() << " cycles with"
+                << " residual " << mg.getResidual() << std::endl;
+    }
+    return x;
+  }
+
+  if(solver == SOR)
+  {
+    SORSolver<double> sor;
+    vector<double> x = sor(makeOperator(partitions), BVec);
+    if(!sor.converged())
+    {
+      std::cerr << "SOR stopped after " << sor.getSweeps() << " sweeps with"
+                << " residual " << sor.getResidual() << std::endl;
+    }
+    return x;
+  }
+
+  if(solver == SPARSE_CHOLESKY)
+  {
+    // Nested dissection of the (N - 1) by (N - 1) grid keeps the fill to
+    // O(n log n) where the band holds n^1.5
+    const SparseCholesky<double> chol(makeSparse(partitions),
+                                      nestedDissection(partitions - 1, partitions - 1));
+    return chol.solve(BVec);
+  }
+
+  GaussianSolver<double> gauss;
+
+  if(solver == CHOLESKY)
+  {
+    return gauss(makeSkyline(partitions), BVec);
+  }
+  if(solver != GAUSSIAN)
+  {
+    throw std::out_of_range("Unknown solver type given");
+  }
+
+  DenseMatrix<double> AMatrix(SIZE, SIZE);
+
+  stencil(partitions, [&](const int col, const int row, const double value)
+  {
+    AMatrix[col][row] = value;
+  });
+
+  return gauss(AMatrix, BVec);
+}
+
+template <typename T>
+DenseMatrix<T> PartialDiff<T>::solve(const DenseMatrix<T>& B, const int partitions,
+                                     const int solver) const
+{
+  const int SIZE = B.getRow();
+  GaussianSolver<double> gauss;
+
+  if(solver == CHOLESKY)
+  {
+    return gauss(makeSkyline(partitions), B);
+  }
+
+  if(solver == GAUSSIAN)
+  {
+    DenseMatrix<double> AMatrix(SIZE, SIZE);
+
+    stencil(partitions, [&](const int col, const int row, const double value)
+    {
+      AMatrix[col][row] = value;
+    });
+
+    return gauss(AMatrix, B);
+  }
+
+  DenseMatrix<T> X(SIZE, B.getCol());
+
+  if(solver == SPARSE_CHOLESKY)
+  {
+    const SparseCholesky<double> chol(makeSparse(partitions),
+                                      nestedDissection(partitions - 1, partitions - 1));
+    for(int c = 0; c < B.getCol(); c++)
+    {
+      X[c] = chol.solve(vector<T>(B[c]));
+    }
+    return X;
+  }
+
+  if(solver == FAST_POISSON)
+  {
+    FastPoissonSolver<T> fast(lowerBound, upperBound);
+    const PoissonOperator<T> A = makeOperator(partitions);
+    for(int c = 0; c < B.getCol(); c++)
+    {
+      X[c] = fast(A, B[c]);
+    }
+    return X;
+  }
 
-  if(choleskySolver)
+  for(int c = 0; c < B.getCol(); c++)
   {
-    return solver(AMatrix.toSym(), BVec);
+    X[c] = solve(vector<T>(B[c]), partitions, solver);
   }
 
-  return solver(AMatrix, BVec);
+  return X;
 }
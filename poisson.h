@@ -0,0 +1,114 @@
+/**
+  * @file   poisson.h
+  * @author Dylan Warren, Oscar Lewzcuk, Section A
+  * @brief  The poisson class applies the five point matrix without storing it.
+*/
+/**
+  * @class  PoissonOperator
+  * @brief  PoissonOperator applies the same A that PartialDiff assembles,
+  *         u(xj, yk) - 1/4 [u(xj-1, yk) + u(xj+1, yk) + u(xj, yk-1) + u(xj, yk+1)],
+  *         straight from the (N-1) by (N-1) interior grid. Boundary values
+  *         are already folded into B by PartialDiff::makeRHS.
+*/
+
+#ifndef POISSON_H
+#define POISSON_H
+
+#include "./vector.h"
+
+template<class T>
+class PoissonOperator
+{
+  private:
+    int m_partitions;
+    int m_line;
+    /**
+      * @brief   Sums the four neighbours of every point on grid line k
+      * @pre     sum must have room for line entries and not overlap x
+      * @post    sum is overwritten
+      * @param   x - Grid values, line by line
+      * @param   sum - Where the neighbour sums go
+      * @param   k - Grid line to sum
+      * @param   line - Points on a grid line, N-1
+      * @return  None
+    */
+    static void neighbourSum(const T* x, T* sum, const int k, const int line);
+  public:
+    /**
+      * @brief   Sets the grid for an N partition mesh
+      * @pre     partitions must be greater than one
+      * @post    Creates an operator on the (N-1)^2 interior points
+      * @param   partitions - Our N.
+      * @return  None
+      * @throw   If partitions is less than 2
+    */
+    PoissonOperator(const int partitions);
+    /**
+      * @brief   Gets the operator row size
+      * @pre     None
+      * @post    None
+      * @return  (N-1)^2
+    */
+    int getRow() const { return m_line * m_line; }
+    /**
+      * @brief   Gets the operator col size
+      * @pre     None
+      * @post    None
+      * @return  (N-1)^2
+    */
+    int getCol() const { return m_line * m_line; }
+    /**
+      * @brief   Gets the N the operator was made for
+      * @pre     None
+      * @post    None
+      * @return  m_partitions
+    */
+    int getPartitions() const { return m_partitions; }
+    /**
+      * @brief   Allows access to matrix elements without storing them.
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  1 on the diagonal, -1/4 for grid neighbours, otherwise 0
+      * @throw   IF col or row are out of bounds
+    */
+    T operator()(const int col, const int row) const;
+    /**
+      * @brief   Computes y = A x one grid line at a time
+      * @pre     x and y must both be (N-1)^2 long and not the same vector
+      * @post    y is overwritten
+      * @param   x - Vector to multiply
+      * @param   y - Vector to store the product in
+      * @return  None
+      * @throw   If x or y are the wrong size
+    */
+    void apply(const vector<T>& x, vector<T>& y) const;
+    /**
+      * @brief   Computes r = b - A x one grid line at a time
+      * @pre     b, x and r must all be (N-1)^2 long, r must not be x
+      * @post    r is overwritten
+      * @param   b - Right hand side
+      * @param   x - Current guess
+      * @param   r - Vector to store the residual in
+      * @return  None
+      * @throw   If b, x or r are the wrong size
+    */
+    void residual(const vector<T>& b, const vector<T>& x, vector<T>& r) const;
+};
+
+/**
+  * @brief   Multiply a PoissonOperator by a vector
+  * @pre     Vector size must match the operator cols
+  * @post    None
+  * @param   lhs - The PoissonOperator to apply
+  * @param   rhs - vector to multiply by
+  * @return  New vector
+  * @throw   If vector size doesn't match the operator
+*/
+template<typename T>
+vector<T> operator*(const PoissonOperator<T>& lhs, const vector<T>& rhs);
+
+#include "./poisson.hpp"
+
+#endif
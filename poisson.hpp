@@ -0,0 +1,143 @@
+/**
+  * @file   poisson.hpp
+  * @author Dylan Warren, Oscar Lewzcuk, Section A
+  * @brief  Implements PoissonOperator functions
+*/
+
+#include <exception>
+#include <cmath>
+
+template<typename T>
+PoissonOperator<T>::PoissonOperator(const int partitions)
+{
+  if(partitions <= 1)
+  {
+    throw std::out_of_range("Invalid partition size given");
+  }
+
+  m_partitions = partitions;
+  m_line = partitions - 1;
+}
+
+template<typename T>
+T PoissonOperator<T>::operator()(const int col, const int row) const
+{
+  if(col < 0 || col >= getCol() || row < 0 || row >= getRow())
+  {
+    std::cerr << "Out of bounds (); Poisson" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  if(col == row)
+  {
+    return 1;
+  }
+  // Same grid line and next to each other, or same spot on adjacent lines
+  const bool sameLine = (col / m_line == row / m_line);
+  if((sameLine && std::abs(col - row) == 1) || std::abs(col - row) == m_line)
+  {
+    return static_cast<T>(-0.25);
+  }
+
+  return 0;
+}
+
+template<typename T>
+void PoissonOperator<T>::neighbourSum(const T* x, T* sum, const int k,
+                                      const int line)
+{
+  const T* xk = x + k * line;
+
+  // Left and right neighbours on the same line, boundary neighbours are in B.
+  if(line == 1)
+  {
+    sum[0] = 0;
+  }
+  else
+  {
+    sum[0] = xk[1];
+    for(int j = 1; j < line - 1; j++)
+    {
+      sum[j] = xk[j - 1] + xk[j + 1];
+    }
+    sum[line - 1] = xk[line - 2];
+  }
+
+  // The lines below and above are whole contiguous runs.
+  if(k > 0)
+  {
+    const T* below = xk - line;
+    for(int j = 0; j < line; j++)
+    {
+      sum[j] += below[j];
+    }
+  }
+  if(k < line - 1)
+  {
+    const T* above = xk + line;
+    for(int j = 0; j < line; j++)
+    {
+      sum[j] += above[j];
+    }
+  }
+}
+
+template<typename T>
+void PoissonOperator<T>::apply(const vector<T>& x, vector<T>& y) const
+{
+  if(x.getSize() != getCol() || y.getSize() != getRow())
+  {
+    std::cerr << "Vector size does not match PoissonOperator" << std::endl;
+    throw std::out_of_range("MISMATCHED VECTOR SIZE; POISSON");
+  }
+
+  const T* xp = x.data();
+  T* yp = y.data();
+
+  for(int k = 0; k < m_line; k++)
+  {
+    T* yk = yp + k * m_line;
+    const T* xk = xp + k * m_line;
+    neighbourSum(xp, yk, k, m_line);
+    for(int j = 0; j < m_line; j++)
+    {
+      yk[j] = xk[j] - static_cast<T>(0.25) * yk[j];
+    }
+  }
+}
+
+template<typename T>
+void PoissonOperator<T>::residual(const vector<T>& b, const vector<T>& x,
+                                  vector<T>& r) const
+{
+  if(b.getSize() != getRow() || x.getSize() != getCol() || r.getSize() != getRow())
+  {
+    std::cerr << "Vector size does not match PoissonOperator" << std::endl;
+    throw std::out_of_range("MISMATCHED VECTOR SIZE; POISSON");
+  }
+
+  const T* bp = b.data();
+  const T* xp = x.data();
+  T* rp = r.data();
+
+  for(int k = 0; k < m_line; k++)
+  {
+    T* rk = rp + k * m_line;
+    const T* xk = xp + k * m_line;
+    const T* bk = bp + k * m_line;
+    neighbourSum(xp, rk, k, m_line);
+    for(int j = 0; j < m_line; j++)
+    {
+      rk[j] = bk[j] - xk[j] + static_cast<T>(0.25) * rk[j];
+    }
+  }
+}
+
+template<typename T>
+vector<T> operator*(const PoissonOperator<T>& lhs, const vector<T>& rhs)
+{
+  vector<T> temp(lhs.getRow());
+  lhs.apply(rhs, temp);
+
+  return temp;
+}
@@ -0,0 +1,140 @@
+/**
+  * @file   preconditioner.h
+  * @author Dylan Warren, Section A
+  * @brief  Preconditioners for the conjugate gradient solver. Each one is a
+            "functor" like class with apply(r, z) solving M z = r.
+*/
+/**
+  * @class  IdentityPreconditioner
+  * @brief  IdentityPreconditioner leaves the residual alone, plain CG
+*/
+/**
+  * @class  JacobiPreconditioner
+  * @brief  JacobiPreconditioner divides by the diagonal of A
+*/
+/**
+  * @class  SSORPreconditioner
+  * @brief  SSORPreconditioner does one symmetric over relaxation sweep
+*/
+/**
+  * @class  IncompleteCholesky
+  * @brief  IncompleteCholesky is IC(0), Cholesky without any fill so L has
+  *         the same pattern as the lower triangle of A
+*/
+
+#ifndef PRECONDITIONER_H
+#define PRECONDITIONER_H
+
+#include "./sparse.h"
+
+template<class T>
+class IdentityPreconditioner
+{
+  public:
+    /**
+      * @brief   Copies r into z
+      * @pre     r and z must be the same size
+      * @post    z is overwritten
+      * @param   r - Residual
+      * @param   z - Where M^-1 r goes
+      * @return  None
+    */
+    void apply(const vector<T>& r, vector<T>& z) const;
+};
+
+template<class T>
+class JacobiPreconditioner
+{
+  private:
+    vector<T> m_inverseDiag;
+  public:
+    /**
+      * @brief   Stores 1 / A(i, i) for every row
+      * @pre     A must be square with no zero on the diagonal
+      * @post    Creates the preconditioner for A
+      * @param   A - Any matrix or operator with A(col, row) access
+      * @return  None
+      * @throw   If A is not square or has a zero on the diagonal
+    */
+    template<class Matrix>
+    JacobiPreconditioner(const Matrix& A);
+    /**
+      * @brief   Computes z = D^-1 r
+      * @pre     r and z must match the size of A
+      * @post    z is overwritten
+      * @param   r - Residual
+      * @param   z - Where M^-1 r goes
+      * @return  None
+    */
+    void apply(const vector<T>& r, vector<T>& z) const;
+};
+
+template<class T>
+class SSORPreconditioner
+{
+  private:
+    SparseMatrix<T> m_lower;
+    vector<T> m_diag;
+    T m_omega;
+  public:
+    /**
+      * @brief   Keeps the lower triangle of A and the relaxation factor
+      * @pre     A must be square with a positive diagonal, 0 < omega < 2
+      * @post    Creates the preconditioner for A
+      * @param   A - The system matrix, symmetric or general storage
+      * @param   omega - Relaxation factor, 1 is symmetric Gauss-Seidel
+      * @return  None
+      * @throw   If omega is outside (0, 2) or a diagonal entry is missing
+    */
+    SSORPreconditioner(const SparseMatrix<T>& A, const T omega = 1);
+    /**
+      * @brief   Computes z = M^-1 r with M = (D + wL) D^-1 (D + wL^T) / (w(2-w))
+      * @pre     r and z must match the size of A
+      * @post    z is overwritten
+      * @param   r - Residual
+      * @param   z - Where M^-1 r goes
+      * @return  None
+    */
+    void apply(const vector<T>& r, vector<T>& z) const;
+};
+
+template<class T>
+class IncompleteCholesky
+{
+  private:
+    SparseMatrix<T> m_factor;
+  public:
+    /**
+      * @brief   Factors A into L L^T keeping only the pattern of A
+      * @pre     A must be symmetric positive definite
+      * @post    Creates the preconditioner for A
+      * @param   A - The system matrix, symmetric or general storage
+      * @return  None
+      * @throw   If a pivot is not positive or a diagonal entry is missing
+    */
+    IncompleteCholesky(const SparseMatrix<T>& A);
+    /**
+      * @brief   Computes z = (L L^T)^-1 r by forward and back substitution
+      * @pre     r and z must match the size of A
+      * @post    z is overwritten
+      * @param   r - Residual
+      * @param   z - Where M^-1 r goes
+      * @return  None
+    */
+    void apply(const vector<T>& r, vector<T>& z) const;
+};
+
+/**
+  * @brief   Copies the lower triangle, diagonal included, out of A
+  * @pre     A must be square and have every diagonal entry stored
+  * @post    None
+  * @param   A - Matrix in symmetric or general storage
+  * @return  Symmetric SparseMatrix whose rows end with the diagonal
+  * @throw   If A is not square or a diagonal entry is missing
+*/
+template<typename T>
+SparseMatrix<T> lowerPart(const SparseMatrix<T>& A);
+
+#include "./preconditioner.hpp"
+
+#endif
@@ -0,0 +1,249 @@
+/**
+  * @file   preconditioner.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Implements the conjugate gradient preconditioners
+*/
+
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+template<typename T>
+SparseMatrix<T> lowerPart(const SparseMatrix<T>& A)
+{
+  if(A.getRow() != A.getCol())
+  {
+    std::cerr << "Preconditioners need a square matrix" << std::endl;
+    throw std::out_of_range("NON SQUARE MATRIX; PRECONDITIONER");
+  }
+
+  const int n = A.getRow();
+  const int* start = A.rowStart();
+  const int* cols = A.colIndex();
+  const T* vals = A.values();
+
+  int nonZeros = 0;
+  for(int i = 0; i < n; i++)
+  {
+    for(int k = start[i]; k < start[i + 1] && cols[k] <= i; k++)
+    {
+      nonZeros++;
+    }
+  }
+
+  SparseMatrix<T> lower(n, n, nonZeros, true);
+  for(int i = 0; i < n; i++)
+  {
+    int last = -1;
+    for(int k = start[i]; k < start[i + 1] && cols[k] <= i; k++)
+    {
+      lower.append(cols[k], vals[k]);
+      last = cols[k];
+    }
+    if(last != i)
+    {
+      std::cerr << "Missing diagonal entry in row " << i << std::endl;
+      throw std::out_of_range("MISSING DIAGONAL; PRECONDITIONER");
+    }
+    lower.closeRow();
+  }
+
+  return lower;
+}
+
+template<typename T>
+void IdentityPreconditioner<T>::apply(const vector<T>& r, vector<T>& z) const
+{
+  const T* rp = r.data();
+  T* zp = z.data();
+  for(int i = 0; i < r.getSize(); i++)
+  {
+    zp[i] = rp[i];
+  }
+}
+
+template<typename T>
+template<class Matrix>
+JacobiPreconditioner<T>::JacobiPreconditioner(const Matrix& A)
+{
+  if(A.getRow() != A.getCol())
+  {
+    std::cerr << "Preconditioners need a square matrix" << std::endl;
+    throw std::out_of_range("NON SQUARE MATRIX; PRECONDITIONER");
+  }
+
+  m_inverseDiag = vector<T>(A.getRow());
+  for(int i = 0; i < A.getRow(); i++)
+  {
+    const T diag = A(i, i);
+    if(diag == 0)
+    {
+      std::cerr << "Zero on the diagonal in row " << i << std::endl;
+      throw std::out_of_range("ZERO DIAGONAL; JACOBI");
+    }
+    m_inverseDiag[i] = 1 / diag;
+  }
+}
+
+template<typename T>
+void JacobiPreconditioner<T>::apply(const vector<T>& r, vector<T>& z) const
+{
+  const T* rp = r.data();
+  const T* dp = m_inverseDiag.data();
+  T* zp = z.data();
+  for(int i = 0; i < r.getSize(); i++)
+  {
+    zp[i] = dp[i] * rp[i];
+  }
+}
+
+template<typename T>
+SSORPreconditioner<T>::SSORPreconditioner(const SparseMatrix<T>& A, const T omega)
+{
+  if(omega <= 0 || omega >= 2)
+  {
+    std::cerr << "SSOR relaxation factor must be between 0 and 2" << std::endl;
+    throw std::out_of_range("BAD OMEGA; SSOR");
+  }
+
+  m_lower = lowerPart(A);
+  m_omega = omega;
+
+  const int n = m_lower.getRow();
+  m_diag = vector<T>(n);
+  for(int i = 0; i < n; i++)
+  {
+    // lowerPart leaves the diagonal last in every row
+    m_diag[i] = m_lower.values()[m_lower.rowStart()[i + 1] - 1];
+  }
+}
+
+template<typename T>
+void SSORPreconditioner<T>::apply(const vector<T>& r, vector<T>& z) const
+{
+  const int n = m_lower.getRow();
+  const int* start = m_lower.rowStart();
+  const int* cols = m_lower.colIndex();
+  const T* vals = m_lower.values();
+  const T* d = m_diag.data();
+  const T* rp = r.data();
+  T* zp = z.data();
+
+  // (D + wL) u = r
+  for(int i = 0; i < n; i++)
+  {
+    T sum = 0;
+    for(int k = start[i]; k < start[i + 1] - 1; k++)
+    {
+      sum += vals[k] * zp[cols[k]];
+    }
+    zp[i] = (rp[i] - m_omega * sum) / d[i];
+  }
+
+  // u = D u, then (D + wL^T) z = u walking the rows of L backwards
+  for(int i = 0; i < n; i++)
+  {
+    zp[i] *= d[i];
+  }
+  for(int i = n - 1; i >= 0; i--)
+  {
+    zp[i] /= d[i];
+    for(int k = start[i]; k < start[i + 1] - 1; k++)
+    {
+      zp[cols[k]] -= m_omega * vals[k] * zp[i];
+    }
+  }
+
+  const T scale = m_omega * (2 - m_omega);
+  for(int i = 0; i < n; i++)
+  {
+    zp[i] *= scale;
+  }
+}
+
+template<typename T>
+IncompleteCholesky<T>::IncompleteCholesky(const SparseMatrix<T>& A)
+{
+  m_factor = lowerPart(A);
+
+  const int n = m_factor.getRow();
+  const int* start = m_factor.rowStart();
+  const int* cols = m_factor.colIndex();
+  T* L = m_factor.values();
+
+  for(int i = 0; i < n; i++)
+  {
+    const int diag = start[i + 1] - 1;
+    for(int k = start[i]; k < diag; k++)
+    {
+      // L(i, j) = (A(i, j) - sum over m < j of L(i, m) L(j, m)) / L(j, j),
+      // the sum only runs over columns both sorted rows share.
+      const int j = cols[k];
+      T sum = 0;
+      int a = start[i];
+      int b = start[j];
+      while(a < k && b < start[j + 1] - 1)
+      {
+        if(cols[a] == cols[b])
+        {
+          sum += L[a] * L[b];
+          a++;
+          b++;
+        }
+        else if(cols[a] < cols[b])
+        {
+          a++;
+        }
+        else
+        {
+          b++;
+        }
+      }
+      L[k] = (L[k] - sum) / L[start[j + 1] - 1];
+    }
+
+    T sum = 0;
+    for(int k = start[i]; k < diag; k++)
+    {
+      sum += L[k] * L[k];
+    }
+    if(L[diag] - sum <= 0)
+    {
+      std::cerr << "Incomplete Cholesky broke down in row " << i << std::endl;
+      throw std::runtime_error("NOT POSITIVE DEFINITE; IC(0)");
+    }
+    L[diag] = std::sqrt(L[diag] - sum);
+  }
+}
+
+template<typename T>
+void IncompleteCholesky<T>::apply(const vector<T>& r, vector<T>& z) const
+{
+  const int n = m_factor.getRow();
+  const int* start = m_factor.rowStart();
+  const int* cols = m_factor.colIndex();
+  const T* L = m_factor.values();
+  const T* rp = r.data();
+  T* zp = z.data();
+
+  // L y = r
+  for(int i = 0; i < n; i++)
+  {
+    T sum = 0;
+    for(int k = start[i]; k < start[i + 1] - 1; k++)
+    {
+      sum += L[k] * zp[cols[k]];
+    }
+    zp[i] = (rp[i] - sum) / L[start[i + 1] - 1];
+  }
+
+  // L^T z = y walking the rows of L backwards
+  for(int i = n - 1; i >= 0; i--)
+  {
+    zp[i] /= L[start[i + 1] - 1];
+    for(int k = start[i]; k < start[i + 1] - 1; k++)
+    {
+      zp[cols[k]] -= L[k] * zp[i];
+    }
+  }
+}
@@ -0,0 +1,217 @@
+/**
+  * @file   reordering.h
+  * @author Dylan Warren, Section A
+  * @brief  Reverse Cuthill-McKee reordering of a symmetric system so band
+            and envelope solvers can be used on it.
+*/
+/**
+  * @class  BandReordering
+  * @brief  BandReordering holds the RCM ordering of one pattern and the
+  *         bandwidth and profile of A before and after it. It moves A to
+  *         P A P^T, B to P B and the solution back with P^T, so
+  *         A x = B becomes (P A P^T)(P x) = P B.
+*/
+
+#ifndef REORDERING_H
+#define REORDERING_H
+
+#include "./ordering.h"
+#include "./dense.h"
+#include "./band.h"
+#include "./skyline.h"
+
+template<class T>
+class BandReordering
+{
+  private:
+    vector<int> m_perm;
+    vector<int> m_inverse;
+    int m_bandBefore;
+    int m_bandAfter;
+    long long m_profileBefore;
+    long long m_profileAfter;
+    /**
+      * @brief   Orders pattern and measures it in both orders
+      * @pre     pattern must be square
+      * @post    Every member is set
+      * @param   pattern - Matrix in symmetric or general storage
+      * @return  None
+      * @throw   If pattern is not square
+    */
+    void build(const SparseMatrix<T>& pattern);
+    /**
+      * @brief   Bandwidth and profile of a pattern in some order
+      * @pre     inverse[i] is the position of row i
+      * @post    band and profile are overwritten
+      * @param   start - Offsets of the pattern's graph
+      * @param   index - Neighbours of every row
+      * @param   inverse - Position of every row
+      * @param   band - Largest |i - j| of an entry
+      * @param   profile - Sum over rows of i less the first col of row i
+      * @return  None
+    */
+    static void measure(const vector<int>& start, const vector<int>& index,
+                        const vector<int>& inverse, int& band, long long& profile);
+  public:
+    /**
+      * @brief   Orders the pattern of a sparse matrix
+      * @pre     A must be square, general storage is made symmetric
+      * @post    The ordering is ready
+      * @param   A - Matrix to reorder
+      * @return  None
+      * @throw   If A is not square
+    */
+    explicit BandReordering(const SparseMatrix<T>& A) { build(A); }
+    /**
+      * @brief   Orders the non zero pattern of a SymMatrix
+      * @pre     A must be square
+      * @post    The ordering is ready
+      * @param   A - Matrix to reorder
+      * @return  None
+      * @throw   If A is not square
+    */
+    explicit BandReordering(const SymMatrix<T>& A) { build(A.toSparse()); }
+    /**
+      * @brief   Orders the non zero pattern of a DenseMatrix, made symmetric
+      * @pre     A must be square
+      * @post    The ordering is ready
+      * @param   A - Matrix to reorder
+      * @return  None
+      * @throw   If A is not square
+    */
+    template<class Layout>
+    explicit BandReordering(const DenseMatrix<T, Layout>& A) { build(A.toSparse()); }
+    /**
+      * @brief   Gets the ordering
+      * @pre     None
+      * @post    None
+      * @return  perm[k] is the row of A placed at k
+    */
+    const vector<int>& getPermutation() const { return m_perm; }
+    /**
+      * @brief   Gets the half bandwidth of A as given
+      * @pre     None
+      * @post    None
+      * @return  Largest |row - col| of an entry
+    */
+    int getBandwidthBefore() const { return m_bandBefore; }
+    /**
+      * @brief   Gets the half bandwidth of P A P^T
+      * @pre     None
+      * @post    None
+      * @return  Largest |row - col| of an entry
+    */
+    int getBandwidthAfter() const { return m_bandAfter; }
+    /**
+      * @brief   Gets the profile of A as given
+      * @pre     None
+      * @post    None
+      * @return  Entries an envelope solver keeps left of the diagonal
+    */
+    long long getProfileBefore() const { return m_profileBefore; }
+    /**
+      * @brief   Gets the profile of P A P^T
+      * @pre     None
+      * @post    None
+      * @return  Entries an envelope solver keeps left of the diagonal
+    */
+    long long getProfileAfter() const { return m_profileAfter; }
+    /**
+      * @brief   Reorders A symmetrically
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder
+      * @return  P A P^T
+      * @throw   If A does not match the ordering
+    */
+    SymMatrix<T> apply(const SymMatrix<T>& A) const;
+    /**
+      * @brief   Reorders A symmetrically, keeping its storage
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder
+      * @return  P A P^T, rows sorted
+      * @throw   If A does not match the ordering
+    */
+    SparseMatrix<T> apply(const SparseMatrix<T>& A) const;
+    /**
+      * @brief   Reorders A straight into band storage of the new bandwidth
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder
+      * @return  P A P^T as a BandSymMatrix
+      * @throw   If A does not match the ordering
+    */
+    BandSymMatrix<T> toBand(const SymMatrix<T>& A) const;
+    /**
+      * @brief   Reorders A straight into band storage of the new bandwidth
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder, symmetric or general storage
+      * @return  P A P^T as a BandSymMatrix
+      * @throw   If A does not match the ordering
+    */
+    BandSymMatrix<T> toBand(const SparseMatrix<T>& A) const;
+    /**
+      * @brief   Reorders A into skyline storage, which keeps getProfileAfter()
+                  entries left of the diagonal
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder
+      * @return  P A P^T as a SkylineSymMatrix
+      * @throw   If A does not match the ordering
+    */
+    SkylineSymMatrix<T> toSkyline(const SymMatrix<T>& A) const
+    { return SkylineSymMatrix<T>(apply(A.toSparse())); }
+    /**
+      * @brief   Reorders A into skyline storage, which keeps getProfileAfter()
+                  entries left of the diagonal
+      * @pre     A must be the matrix that was ordered
+      * @post    None
+      * @param   A - Matrix to reorder, symmetric or general storage
+      * @return  P A P^T as a SkylineSymMatrix
+      * @throw   If A does not match the ordering
+    */
+    SkylineSymMatrix<T> toSkyline(const SparseMatrix<T>& A) const
+    { return SkylineSymMatrix<T>(apply(A)); }
+    /**
+      * @brief   Reorders a right hand side
+      * @pre     None
+      * @post    None
+      * @param   B - Vector "B" in the equation
+      * @return  P B
+      * @throw   If B does not match the ordering
+    */
+    vector<T> apply(const vector<T>& B) const;
+    /**
+      * @brief   Reorders every column of B
+      * @pre     None
+      * @post    None
+      * @param   B - One right hand side per column
+      * @return  P B
+      * @throw   If B does not match the ordering
+    */
+    DenseMatrix<T> apply(const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Puts a solution of the reordered system back in A's order
+      * @pre     None
+      * @post    None
+      * @param   x - Solution of (P A P^T) y = P B
+      * @return  P^T x
+      * @throw   If x does not match the ordering
+    */
+    vector<T> restore(const vector<T>& x) const;
+    /**
+      * @brief   Puts every column of X back in A's order
+      * @pre     None
+      * @post    None
+      * @param   X - One solution of the reordered system per column
+      * @return  P^T X
+      * @throw   If X does not match the ordering
+    */
+    DenseMatrix<T> restore(const DenseMatrix<T>& X) const;
+};
+
+#include "./reordering.hpp"
+
+#endif
@@ -0,0 +1,263 @@
+/**
+  * @file   reordering.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines BandReordering functions
+*/
+#include <algorithm>
+#include <stdexcept>
+
+template<typename T>
+void BandReordering<T>::build(const SparseMatrix<T>& pattern)
+{
+  m_perm = reverseCuthillMcKee(pattern);
+  m_inverse = inversePermutation(m_perm);
+
+  vector<int> start;
+  vector<int> index;
+  adjacency(pattern, start, index);
+  vector<int> identity(pattern.getRow());
+  for(int i = 0; i < identity.getSize(); i++)
+  {
+    identity[i] = i;
+  }
+  measure(start, index, identity, m_bandBefore, m_profileBefore);
+  measure(start, index, m_inverse, m_bandAfter, m_profileAfter);
+}
+
+template<typename T>
+void BandReordering<T>::measure(const vector<int>& start, const vector<int>& index,
+                                const vector<int>& inverse, int& band, long long& profile)
+{
+  band = 0;
+  profile = 0;
+  for(int r = 0; r < inverse.getSize(); r++)
+  {
+    const int i = inverse[r];
+    int first = i;
+    for(int k = start[r]; k < start[r + 1]; k++)
+    {
+      const int j = inverse[index[k]];
+      band = (j - i > band ? j - i : (i - j > band ? i - j : band));
+      first = (j < first ? j : first);
+    }
+    profile += i - first;
+  }
+}
+
+template<typename T>
+SymMatrix<T> BandReordering<T>::apply(const SymMatrix<T>& A) const
+{
+  const int n = m_perm.getSize();
+  if(A.getRow() != n || A.getCol() != n)
+  {
+    std::cerr << "SymMatrix size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  SymMatrix<T> result(n, n);
+  for(int col = 0; col < n; col++)
+  {
+    const T* a = A.column(col);
+    for(int row = col; row < n; row++)
+    {
+      if(a[row - col] != 0)
+      {
+        result(m_inverse[col], m_inverse[row]) = a[row - col];
+      }
+    }
+  }
+
+  return result;
+}
+
+template<typename T>
+SparseMatrix<T> BandReordering<T>::apply(const SparseMatrix<T>& A) const
+{
+  const int n = m_perm.getSize();
+  if(A.getRow() != n || A.getCol() != n)
+  {
+    std::cerr << "SparseMatrix size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  const int* rowStart = A.rowStart();
+  const int* cols = A.colIndex();
+  const T* vals = A.values();
+  const int nonZeros = A.getNonZeros();
+  const bool symmetric = A.isSymmetric();
+
+  // Entry k moves to (newRow[k], newCol[k]), the lower half stays lower
+  vector<int> newRow(nonZeros > 0 ? nonZeros : 1);
+  vector<int> newCol(nonZeros > 0 ? nonZeros : 1);
+  vector<int> start(n + 1);
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      int i = m_inverse[r];
+      int j = m_inverse[cols[k]];
+      if(symmetric && j > i)
+      {
+        std::swap(i, j);
+      }
+      newRow[k] = i;
+      newCol[k] = j;
+      start[i + 1]++;
+    }
+  }
+  for(int i = 0; i < n; i++)
+  {
+    start[i + 1] += start[i];
+  }
+
+  vector<int> order(nonZeros > 0 ? nonZeros : 1);
+  vector<int> fill(n);
+  for(int k = 0; k < nonZeros; k++)
+  {
+    order[start[newRow[k]] + fill[newRow[k]]++] = k;
+  }
+
+  SparseMatrix<T> result(n, n, (nonZeros > 0 ? nonZeros : 1), symmetric);
+  for(int i = 0; i < n; i++)
+  {
+    int* first = order.data() + start[i];
+    int* last = order.data() + start[i + 1];
+    std::sort(first, last, [&](const int a, const int b) { return newCol[a] < newCol[b]; });
+    for(int* k = first; k < last; k++)
+    {
+      result.append(newCol[*k], vals[*k]);
+    }
+    result.closeRow();
+  }
+
+  return result;
+}
+
+template<typename T>
+BandSymMatrix<T> BandReordering<T>::toBand(const SymMatrix<T>& A) const
+{
+  const int n = m_perm.getSize();
+  if(A.getRow() != n || A.getCol() != n)
+  {
+    std::cerr << "SymMatrix size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  BandSymMatrix<T> result(n, m_bandAfter);
+  for(int col = 0; col < n; col++)
+  {
+    const T* a = A.column(col);
+    for(int row = col; row < n; row++)
+    {
+      if(a[row - col] != 0)
+      {
+        result(m_inverse[col], m_inverse[row]) = a[row - col];
+      }
+    }
+  }
+
+  return result;
+}
+
+template<typename T>
+BandSymMatrix<T> BandReordering<T>::toBand(const SparseMatrix<T>& A) const
+{
+  const int n = m_perm.getSize();
+  if(A.getRow() != n || A.getCol() != n)
+  {
+    std::cerr << "SparseMatrix size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  const int* rowStart = A.rowStart();
+  const int* cols = A.colIndex();
+  const T* vals = A.values();
+  BandSymMatrix<T> result(n, m_bandAfter);
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      result(m_inverse[cols[k]], m_inverse[r]) = vals[k];
+    }
+  }
+
+  return result;
+}
+
+template<typename T>
+vector<T> BandReordering<T>::apply(const vector<T>& B) const
+{
+  if(B.getSize() != m_perm.getSize())
+  {
+    std::cerr << "Vector B size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  vector<T> result(B.getSize());
+  for(int k = 0; k < B.getSize(); k++)
+  {
+    result[k] = B[m_perm[k]];
+  }
+
+  return result;
+}
+
+template<typename T>
+DenseMatrix<T> BandReordering<T>::apply(const DenseMatrix<T>& B) const
+{
+  if(B.getRow() != m_perm.getSize())
+  {
+    std::cerr << "Matrix B rows do not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  DenseMatrix<T> result(B.getRow(), B.getCol());
+  for(int col = 0; col < B.getCol(); col++)
+  {
+    for(int k = 0; k < B.getRow(); k++)
+    {
+      result(col, k) = B(col, m_perm[k]);
+    }
+  }
+
+  return result;
+}
+
+template<typename T>
+vector<T> BandReordering<T>::restore(const vector<T>& x) const
+{
+  if(x.getSize() != m_perm.getSize())
+  {
+    std::cerr << "Vector x size does not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  vector<T> result(x.getSize());
+  for(int k = 0; k < x.getSize(); k++)
+  {
+    result[m_perm[k]] = x[k];
+  }
+
+  return result;
+}
+
+template<typename T>
+DenseMatrix<T> BandReordering<T>::restore(const DenseMatrix<T>& X) const
+{
+  if(X.getRow() != m_perm.getSize())
+  {
+    std::cerr << "Matrix X rows do not match the ordering" << std::endl;
+    throw std::out_of_range("MISS MATCHING SIZE; REORDERING");
+  }
+
+  DenseMatrix<T> result(X.getRow(), X.getCol());
+  for(int col = 0; col < X.getCol(); col++)
+  {
+    for(int k = 0; k < X.getRow(); k++)
+    {
+      result(col, m_perm[k]) = X(col, k);
+    }
+  }
+
+  return result;
+}
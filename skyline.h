@@ -0,0 +1,203 @@
+/**
+  * @file   skyline.h
+  * @author Dylan Warren, Section A
+  * @brief  The skyline class is a symmetric matrix stored by its envelope.
+*/
+/**
+  * @class  SkylineSymMatrix
+  * @brief  SkylineSymMatrix stores, for every row, the entries from its
+  *         first non zero up to the diagonal, everything left of that is 0.
+  *         Cholesky fill never reaches left of a row's first non zero, so
+  *         the envelope can be factored in place and both memory and work
+  *         follow the profile of the matrix rather than a fixed band.
+*/
+
+#ifndef SKYLINE_H
+#define SKYLINE_H
+
+#include "./matrix.h"
+#include "./sparse.h"
+#include "./symmetric.h"
+
+template<class T>
+class SkylineSymMatrix : public matrix<SkylineSymMatrix<T>, T>
+{
+  private:
+    int m_size;
+    // Row i holds cols m_first[i] .. i at ptr_to_data[m_start[i] ...]
+    vector<int> m_first;
+    vector<int> m_start;
+    vector<T> ptr_to_data;
+    /**
+      * @brief   Makes room for the envelope described by first, all set to 0
+      * @pre     None
+      * @post    m_size, m_first, m_start and ptr_to_data are set
+      * @param   first - First stored col of every row
+      * @return  None
+      * @throw   If first is empty or some first[i] is not in 0 .. i
+    */
+    void allocate(const vector<int>& first);
+  public:
+    /**
+      * @brief   Sets size to 0 and leaves the storage empty
+      * @pre     None
+      * @post    All member variables are set.
+      * @return  None
+    */
+    SkylineSymMatrix() : m_size(0), m_first(vector<int>()), m_start(vector<int>()),
+                         ptr_to_data(vector<T>()) {};
+    /**
+      * @brief   Makes an envelope of zeros, row i keeps cols first[i] .. i
+      * @pre     0 <= first[i] <= i for every row
+      * @post    Creates a fresh first.getSize() square SkylineSymMatrix
+      * @param   first - First stored col of every row
+      * @return  None
+      * @throw   If first is empty or some first[i] is not in 0 .. i
+    */
+    explicit SkylineSymMatrix(const vector<int>& first);
+    /**
+      * @brief   Copies A into the smallest envelope that holds its pattern
+      * @pre     A must be square, general storage must be symmetric
+      * @post    Creates a new SkylineSymMatrix equal to A
+      * @param   A - Matrix in symmetric or general storage
+      * @return  None
+      * @throw   If A is not square
+    */
+    explicit SkylineSymMatrix(const SparseMatrix<T>& A);
+    /**
+      * @brief   Copies the non zeros of A into the smallest envelope that
+                  holds them
+      * @pre     None
+      * @post    Creates a new SkylineSymMatrix equal to A
+      * @param   A - Matrix to copy
+      * @return  None
+      * @throw   If A is empty
+    */
+    explicit SkylineSymMatrix(const SymMatrix<T>& A);
+    /**
+      * @brief   Copies source into a new SkylineSymMatrix
+      * @pre     None
+      * @post    Creates a new SkylineSymMatrix object that is identical to source
+      * @param   source - SkylineSymMatrix to copy
+      * @return  None
+    */
+    SkylineSymMatrix(const SkylineSymMatrix& source) = default;
+    /**
+      * @brief   Moves other's data into a new SkylineSymMatrix
+      * @pre     None
+      * @post    Moves other's data into C.O
+      * @param   other - SkylineSymMatrix to move
+      * @return  None
+    */
+    SkylineSymMatrix(SkylineSymMatrix&& other) = default;
+    /**
+      * @brief   Copies content from rhs into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   rhs - The SkylineSymMatrix to copy
+      * @return  *this as the C.O is being altered
+    */
+    SkylineSymMatrix& operator=(const SkylineSymMatrix& rhs) = default;
+    /**
+      * @brief   Move content from other into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   other - the SkylineSymMatrix to move
+      * @return  *this as the C.O is being altered
+    */
+    SkylineSymMatrix& operator=(SkylineSymMatrix&& other) = default;
+    /**
+      * @brief   Allows access to matrix elements.
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  Value at col, row or 0 outside of the envelope
+      * @throw   IF col or row are out of bounds
+    */
+    T operator()(const int col, const int row) const;
+    /**
+      * @brief   Allows access to matrix elements.
+      * @pre     col and row must be within bounds and the envelope
+      * @post    Allows the index to be changed, (row, col) changes with it
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  Reference to the stored value
+      * @throw   If col or row are out of bounds or outside of the envelope
+    */
+    T& operator()(const int col, const int row);
+    /**
+      * @brief   Gets the SkylineSymMatrix row size
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getRow() const { return m_size; }
+    /**
+      * @brief   Gets the SkylineSymMatrix col size
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getCol() const { return m_size; }
+    /**
+      * @brief   Gets the first stored col of a row
+      * @pre     row must be within bounds
+      * @post    None
+      * @param   row - row of the matrix
+      * @return  m_first[row]
+    */
+    int getFirst(const int row) const { return m_first[row]; }
+    /**
+      * @brief   Gets the profile, the entries stored left of the diagonal
+      * @pre     None
+      * @post    None
+      * @return  Sum over rows of row - first col
+    */
+    long long getProfile() const;
+    /**
+      * @brief   Gets a stored row indexed by col, valid for getFirst(row)
+                  through row
+      * @pre     row must be within bounds
+      * @post    None
+      * @param   row - row of the matrix
+      * @return  Pointer p with p[col] the entry at (col, row)
+    */
+    const T* rowData(const int row) const
+    { return ptr_to_data.data() + m_start[row] - m_first[row]; }
+    /**
+      * @brief   Gets a stored row indexed by col, see the const version
+      * @pre     row must be within bounds
+      * @post    The row may be changed through the pointer
+      * @param   row - row of the matrix
+      * @return  Pointer p with p[col] the entry at (col, row)
+    */
+    T* rowData(const int row) { return ptr_to_data.data() + m_start[row] - m_first[row]; }
+};
+
+/**
+  * @brief   Multiply a SkylineSymMatrix by a vector
+  * @pre     Vector size must match SkylineSymMatrix cols
+  * @post    None
+  * @param   lhs - The SkylineSymMatrix to multiply
+  * @param   rhs - vector to multiply by
+  * @return  New vector
+  * @throw   If vector size doesn't match SkylineSymMatrix size
+*/
+template<typename T>
+vector<T> operator*(const SkylineSymMatrix<T>& lhs, const vector<T>& rhs);
+
+/**
+  * @brief   Displays the entries of the SkylineSymMatrix
+  * @pre     None
+  * @post    Displays the SkylineSymMatrix
+  * @param   out - ostream object used to display the SkylineSymMatrix
+  * @param   m - SkylineSymMatrix object to read data in from
+  * @return  The modified ostream object
+*/
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const SkylineSymMatrix<T>& m);
+
+#include "./skyline.hpp"
+
+#endif
@@ -0,0 +1,220 @@
+/**
+  * @file   skyline.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Implements SkylineSymMatrix operators
+*/
+
+#include <exception>
+
+template<typename T>
+void SkylineSymMatrix<T>::allocate(const vector<int>& first)
+{
+  m_size = first.getSize();
+  m_first = first;
+  m_start = vector<int>(m_size + 1);
+  m_start[0] = 0;
+  for(int i = 0; i < m_size; i++)
+  {
+    if(first[i] < 0 || first[i] > i)
+    {
+      std::cerr << "Row " << i << " starts outside of 0 .. " << i << "; Skyline" << std::endl;
+      throw std::out_of_range("BAD ENVELOPE; SKYLINE");
+    }
+    m_start[i + 1] = m_start[i] + i - first[i] + 1;
+  }
+
+  ptr_to_data = vector<T>(m_start[m_size]);
+  for(int k = 0; k < m_start[m_size]; k++)
+  {
+    ptr_to_data[k] = 0;
+  }
+}
+
+template<typename T>
+SkylineSymMatrix<T>::SkylineSymMatrix(const vector<int>& first)
+{
+  allocate(first);
+}
+
+template<typename T>
+SkylineSymMatrix<T>::SkylineSymMatrix(const SparseMatrix<T>& A)
+{
+  if(A.getRow() != A.getCol())
+  {
+    std::cerr << "A skyline needs a square matrix" << std::endl;
+    throw std::out_of_range("NON SQUARE MATRIX; SKYLINE");
+  }
+
+  const int n = A.getRow();
+  const int* rowStart = A.rowStart();
+  const int* cols = A.colIndex();
+  const T* vals = A.values();
+
+  // Entry (c, r) with c < r pulls row r out to c. General storage also
+  // holds it as (r, c), which is skipped.
+  vector<int> first(n);
+  for(int r = 0; r < n; r++)
+  {
+    first[r] = r;
+  }
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      const int c = cols[k];
+      const int row = (c > r ? c : r);
+      const int col = (c > r ? r : c);
+      first[row] = (col < first[row] ? col : first[row]);
+    }
+  }
+  allocate(first);
+
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      if(cols[k] <= r)
+      {
+        rowData(r)[cols[k]] = vals[k];
+      }
+    }
+  }
+}
+
+template<typename T>
+SkylineSymMatrix<T>::SkylineSymMatrix(const SymMatrix<T>& A)
+{
+  const int n = A.getRow();
+  if(n <= 0)
+  {
+    std::cerr << "Size less than one; Skyline" << std::endl;
+    throw std::out_of_range("BAD ENVELOPE; SKYLINE");
+  }
+
+  // Columns come in rising order, so the first col that reaches a row is
+  // where that row starts
+  vector<int> first(n);
+  for(int r = 0; r < n; r++)
+  {
+    first[r] = r;
+  }
+  for(int col = 0; col < n; col++)
+  {
+    const T* a = A.column(col);
+    for(int r = col + 1; r < n; r++)
+    {
+      if(a[r - col] != 0 && first[r] == r)
+      {
+        first[r] = col;
+      }
+    }
+  }
+  allocate(first);
+
+  for(int col = 0; col < n; col++)
+  {
+    const T* a = A.column(col);
+    for(int r = col; r < n; r++)
+    {
+      if(col >= first[r])
+      {
+        rowData(r)[col] = a[r - col];
+      }
+    }
+  }
+}
+
+template<typename T>
+T SkylineSymMatrix<T>::operator()(const int col, const int row) const
+{
+  if(col < 0 || col >= m_size || row < 0 || row >= m_size)
+  {
+    std::cerr << "Out of bounds (); Skyline" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; SKYLINE");
+  }
+
+  const int r = (row > col ? row : col);
+  const int c = (row > col ? col : row);
+  if(c < m_first[r])
+  {
+    return 0;
+  }
+
+  return rowData(r)[c];
+}
+
+template<typename T>
+T& SkylineSymMatrix<T>::operator()(const int col, const int row)
+{
+  if(col < 0 || col >= m_size || row < 0 || row >= m_size)
+  {
+    std::cerr << "Out of bounds (); Skyline" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; SKYLINE");
+  }
+
+  const int r = (row > col ? row : col);
+  const int c = (row > col ? col : row);
+  if(c < m_first[r])
+  {
+    std::cerr << "Tried to set a value outside of the envelope" << std::endl;
+    throw std::out_of_range("OUTSIDE OF ENVELOPE; SKYLINE");
+  }
+
+  return rowData(r)[c];
+}
+
+template<typename T>
+long long SkylineSymMatrix<T>::getProfile() const
+{
+  return static_cast<long long>(m_start[m_size]) - m_size;
+}
+
+template<typename T>
+vector<T> operator*(const SkylineSymMatrix<T>& lhs, const vector<T>& rhs)
+{
+  if(lhs.getCol() != rhs.getSize())
+  {
+    std::cerr << "Vector size and SkylineSymMatrix size do not match" << std::endl;
+    throw std::out_of_range("MISMATCHED VECTOR SIZE AND MATRIX SIZE");
+  }
+
+  const int n = lhs.getRow();
+  const T* x = rhs.data();
+  vector<T> temp(n);
+  T* y = temp.data();
+
+  for(int i = 0; i < n; i++)
+  {
+    y[i] = 0;
+  }
+
+  // Each stored entry left of the diagonal is used for its row and its mirror.
+  for(int i = 0; i < n; i++)
+  {
+    const T* rowI = lhs.rowData(i);
+    T sum = 0;
+    for(int j = lhs.getFirst(i); j < i; j++)
+    {
+      sum += rowI[j] * x[j];
+      y[j] += rowI[j] * x[i];
+    }
+    y[i] += sum + rowI[i] * x[i];
+  }
+
+  return temp;
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const SkylineSymMatrix<T>& m)
+{
+  for(int i = 0; i < m.getRow(); i++)
+  {
+    for(int j = 0; j < m.getCol(); j++)
+    {
+      out << m(j, i) << " ";
+    }
+    out << std::endl;
+  }
+
+  return out;
+}
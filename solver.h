@@ -13,26 +13,93 @@
 /** Numbers can get tiny and it's basically 0 at that point */
 #define EPSILON 0.00000001
 #include "./dense.h"
+#include "./lu.h"
+#include "./cholesky.h"
+#include "./ldlt.h"
 #include "./upper.h"
 #include "./lower.h"
+#include "./transposed.h"
 #include "./symmetric.h"
 #include "./tridiagonal.h"
+#include "./band.h"
+#include "./skyline.h"
 
 template<class T>
 class GaussianSolver
 {
+  private:
+    /**
+      * @brief   Eliminates the sub diagonal with the Thomas algo, once for
+                  every right hand side
+      * @pre     x holds B, one column every ldx values
+      * @post    x holds the solutions
+      * @param   source - Tridiagonal matrix
+      * @param   x - First right hand side
+      * @param   count - Right hand sides
+      * @param   ldx - Distance between right hand sides
+      * @return  None
+    */
+    static void substitute(const TriDiag<T>& source, T* x, const int count,
+                           const int ldx);
+    /**
+      * @brief   Factors a band in place, row i of L overwrites row i of A
+      * @pre     L holds a positive definite band
+      * @post    L holds the Cholesky factor
+      * @param   L - Band to factor
+      * @return  None
+      * @throw   If L is not positive definite
+    */
+    static void factor(BandSymMatrix<T>& L);
+    /**
+      * @brief   Solves L L^T x = B for count right hand sides, each row of L
+                  is loaded once for all of them
+      * @pre     L comes from factor, x holds B, one column every ldx values
+      * @post    x holds the solutions
+      * @param   L - Band Cholesky factor
+      * @param   x - First right hand side
+      * @param   count - Right hand sides
+      * @param   ldx - Distance between right hand sides
+      * @return  None
+    */
+    static void substitute(const BandSymMatrix<T>& L, T* x, const int count,
+                           const int ldx);
+    /**
+      * @brief   Factors an envelope in place, row i of L overwrites row i of
+                  A. Each product only starts where both rows have entries.
+      * @pre     L holds a positive definite envelope
+      * @post    L holds the Cholesky factor
+      * @param   L - Envelope to factor
+      * @return  None
+      * @throw   If L is not positive definite
+    */
+    static void factor(SkylineSymMatrix<T>& L);
+    /**
+      * @brief   Solves L L^T x = B for count right hand sides, each row of L
+                  is loaded once for all of them
+      * @pre     L comes from factor, x holds B, one column every ldx values
+      * @post    x holds the solutions
+      * @param   L - Envelope Cholesky factor
+      * @param   x - First right hand side
+      * @param   count - Right hand sides
+      * @param   ldx - Distance between right hand sides
+      * @return  None
+    */
+    static void substitute(const SkylineSymMatrix<T>& L, T* x, const int count,
+                           const int ldx);
   public:
     /**
-      * @brief   Solves the system of equations for the x vector by using the
-                scaled partial pivoting method to make an upper triangle matrix
-                that then determines the x vector from.
+      * @brief   Solves the system of equations for the x vector with a blocked
+                LU factorization using scaled partial pivoting. Factor with
+                LUFactorization directly to reuse it for more vectors.
       * @pre     None
       * @post    None
       * @param   source - Matrix "A" in the equation
       * @param   B - Vector "B" in the equation
       * @return  the solved x vector
+      * @throw   If sizes do not match or source is singular
     */
-    vector<T> operator()(const DenseMatrix<T>& source, const vector<T>& B) const;
+    template<class Layout>
+    vector<T> operator()(const DenseMatrix<T, Layout>& source, const vector<T>& B) const;
     /**
       * @brief   Solves for x vector by back substituting
       * @pre     None
@@ -52,12 +119,16 @@ class GaussianSolver
     */
     vector<T> operator()(const LowerTriangle<T>& source, const vector<T>& B) const;
     /**
-      * @brief   Solves for x vector by using the Cholesky algo
+      * @brief   Solves for x vector by using the Cholesky algo, falling back
+                  to a Bunch-Kaufman LDL^T when source is not positive
+                  definite. Build a CholeskyFactor or LDLTFactorization
+                  directly to reuse it for more vectors.
       * @pre     None
       * @post    None
       * @param   source - Matrix "A" in the equation
       * @param   B - Vector "B" in the equation
       * @return  The solved x vector
+      * @throw   If sizes do not match or source is singular
     */
     vector<T> operator()(const SymMatrix<T>& source, const vector<T>& B) const;
     /**
@@ -69,6 +140,146 @@ class GaussianSolver
       * @return  The solved x vector
     */
     vector<T> operator()(const TriDiag<T>& source, const vector<T>& B) const;
+    /**
+      * @brief   Solves for x vector by using the Cholesky algo on the band,
+                  the factor overwrites a copy of source so memory stays
+                  O(n * band) and time O(n * band^2)
+      * @pre     source must be positive definite
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If sizes do not match or source is not positive definite
+    */
+    vector<T> operator()(const BandSymMatrix<T>& source, const vector<T>& B) const;
+    /**
+      * @brief   Solves for x vector by using the Cholesky algo on the
+                  envelope, the factor overwrites a copy of source so memory
+                  and time follow the profile of source
+      * @pre     source must be positive definite
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If sizes do not match or source is not positive definite
+    */
+    vector<T> operator()(const SkylineSymMatrix<T>& source, const vector<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B with one LU factorization
+      * @pre     None
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match or source is singular
+    */
+    template<class Layout>
+    DenseMatrix<T> operator()(const DenseMatrix<T, Layout>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Back substitutes every column of B with the blocked tpsm
+      * @pre     None
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match
+    */
+    DenseMatrix<T> operator()(const UpperTriangle<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Forward substitutes every column of B with the blocked tpsm
+      * @pre     None
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match
+    */
+    DenseMatrix<T> operator()(const LowerTriangle<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B with one Cholesky factor,
+                  or one LDL^T factor when source is not positive definite
+      * @pre     None
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match or source is singular
+    */
+    DenseMatrix<T> operator()(const SymMatrix<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B in one Thomas sweep
+      * @pre     None
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match
+    */
+    DenseMatrix<T> operator()(const TriDiag<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B, the band is factored
+                  once and each row of L is read once per substitution
+      * @pre     source must be positive definite
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match or source is not positive definite
+    */
+    DenseMatrix<T> operator()(const BandSymMatrix<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves A X = B for every column of B, the envelope is
+                  factored once and each row of L is read once per substitution
+      * @pre     source must be positive definite
+      * @post    None
+      * @param   source - Matrix "A" in the equation
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match or source is not positive definite
+    */
+    DenseMatrix<T> operator()(const SkylineSymMatrix<T>& source, const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves L^T x = B by back substituting on L's own storage
+      * @pre     None
+      * @post    None
+      * @param   source - View of L as L^T, see transposedView
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If sizes do not match
+    */
+    vector<T> operator()(const TransposedView<LowerTriangle<T>>& source, const vector<T>& B) const;
+    /**
+      * @brief   Solves U^T x = B by forward substituting on U's own storage
+      * @pre     None
+      * @post    None
+      * @param   source - View of U as U^T, see transposedView
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If sizes do not match
+    */
+    vector<T> operator()(const TransposedView<UpperTriangle<T>>& source, const vector<T>& B) const;
+    /**
+      * @brief   Solves L^T X = B for every column of B in one pass over L
+      * @pre     None
+      * @post    None
+      * @param   source - View of L as L^T, see transposedView
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match
+    */
+    DenseMatrix<T> operator()(const TransposedView<LowerTriangle<T>>& source,
+                              const DenseMatrix<T>& B) const;
+    /**
+      * @brief   Solves U^T X = B for every column of B in one pass over U
+      * @pre     None
+      * @post    None
+      * @param   source - View of U as U^T, see transposedView
+      * @param   B - One right hand side per column
+      * @return  X, one solution per column
+      * @throw   If sizes do not match
+    */
+    DenseMatrix<T> operator()(const TransposedView<UpperTriangle<T>>& source,
+                              const DenseMatrix<T>& B) const;
 };
 
 #include "./solver.hpp"
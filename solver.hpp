@@ -4,128 +4,241 @@
   * @brief  Defines the () operator to solve a system of equations
 */
 #include <limits>
+#include <stdexcept>
 #include <cmath>
 
 template<typename T>
-vector<T> GaussianSolver<T>::operator()(const DenseMatrix<T>& source,
+template<class Layout>
+vector<T> GaussianSolver<T>::operator()(const DenseMatrix<T, Layout>& source,
                                                const vector<T>& B) const
 {
-  DenseMatrix<T> augMatrix;
-  try
+  if(source.getRow() != B.getSize() || source.getRow() != source.getCol())
   {
-    augMatrix = makeAug(source, B);
+    std::cerr << "Vector B size does not match Matrix row size." << std::endl;
+    throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE");
   }
-  catch(const std::exception& e)
+
+  vector<T> x = LUFactorization<T>(source).solve(B);
+  for(int i = 0; i < x.getSize(); i++)
   {
-    std::cerr << e.what() << std::endl;
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
   }
 
-  vector<T> x(augMatrix.getRow());
-  vector<T> rowVector(augMatrix.getCol()); // Helps make swapping rows easy
-  vector<T> scale_factor(augMatrix.getRow());
-  vector<T> ratio_vector(augMatrix.getRow());
+  return x;
+}
+
+template<typename T>
+void GaussianSolver<T>::substitute(const TriDiag<T>& source, T* x, const int count,
+                                   const int ldx)
+{
+  TriDiag<T> temp(source);
+  const int n = source.getRow();
 
-  // Time to fill out the scale factor
-  for(int i = 0; i < augMatrix.getCol() - 1; i++)
+  for(int i = 1; i < n; i++)
   {
-    T maxValue = std::numeric_limits<T>::lowest();
-    for(int j = 0; j < augMatrix.getRow(); j++)
+    // Ai = Ai/Bi-1
+    temp(i - 1, i) /= temp(i - 1, i - 1);
+    // Bi = Bi - Ai * Ci-1
+    temp(i, i) -= temp(i - 1, i) * temp(i , i - 1);
+    // Ri = Ri  Ai * Ri-1
+    const T a = temp(i - 1, i);
+    for(int c = 0; c < count; c++)
     {
-      if(std::abs(augMatrix[j][i]) > maxValue)
-      {
-        maxValue = std::abs(augMatrix[j][i]);
-      }
+      x[c * ldx + i] -= a * x[c * ldx + i - 1];
     }
-    scale_factor[i] = maxValue;
-    maxValue = std::numeric_limits<T>::lowest();
   }
 
-  for(int i = 0; i < augMatrix.getRow(); i++)
+  const T last = temp(n - 1, n - 1);
+  for(int c = 0; c < count; c++)
   {
-    int index = 0;
-    //Calculate ratio vector
-    for(int k = 0; k < scale_factor.getSize(); k++)
+    x[c * ldx + n - 1] /= last;
+  }
+
+  for(int i = n - 2; i >= 0; i--)
+  {
+    const T upper = temp(i + 1, i);
+    const T diag = temp(i, i);
+    for(int c = 0; c < count; c++)
     {
-      ratio_vector[k] = std::abs(augMatrix[i][k]) / scale_factor[k];
+      x[c * ldx + i] = (x[c * ldx + i] - upper * x[c * ldx + i + 1]) / diag;
     }
+  }
+}
 
-    // This index determines the "highest" level rows can swap with.
-    index = maxIndex(ratio_vector, i);
+template<typename T>
+void GaussianSolver<T>::factor(BandSymMatrix<T>& L)
+{
+  const int n = L.getRow();
+  const int band = L.getBand();
+  const int width = band + 1;
+  T* l = L.data();
 
-    for(int col = 0; col < augMatrix.getCol(); col++)
+  // Row i of L lives at l[i*width + band - i + col], so every inner product
+  // below runs over two contiguous rows.
+  for(int i = 0; i < n; i++)
+  {
+    const int first = (i - band > 0 ? i - band : 0);
+    T* rowI = l + i * width + band - i;
+    for(int j = first; j <= i; j++)
     {
-      rowVector[col] = augMatrix[col][i];
-    }
-    // Swap rows
-    if((index - i) != 0)
-    { 
-      for(int col = 0; col < augMatrix.getCol(); col++)
+      const T* rowJ = l + j * width + band - j;
+      T sum = 0;
+      for(int k = first; k < j; k++)
+      {
+        sum += rowI[k] * rowJ[k];
+      }
+      if(i == j)
+      {
+        if(rowI[i] - sum <= 0)
+        {
+          std::cerr << "Band matrix is not positive definite" << std::endl;
+          throw std::runtime_error("NOT POSITIVE DEFINITE; BAND");
+        }
+        rowI[i] = std::sqrt(rowI[i] - sum);
+      }
+      else
       {
-        augMatrix[col][i] = augMatrix[col][index];
-        augMatrix[col][index] = rowVector[col];
+        rowI[j] = (rowI[j] - sum) / rowJ[j];
       }
-      // Since our "top" rowVector changed have to adjust for the new top vec.
-      for(int col = 0; col < augMatrix.getCol(); col++)
+    }
+  }
+}
+
+template<typename T>
+void GaussianSolver<T>::substitute(const BandSymMatrix<T>& L, T* x, const int count,
+                                   const int ldx)
+{
+  const int n = L.getRow();
+  const int band = L.getBand();
+  const int width = band + 1;
+  const T* l = L.data();
+
+  // L y = B
+  for(int i = 0; i < n; i++)
+  {
+    const int first = (i - band > 0 ? i - band : 0);
+    const T* rowI = l + i * width + band - i;
+    for(int c = 0; c < count; c++)
+    {
+      T* y = x + c * ldx;
+      T sum = 0;
+      for(int k = first; k < i; k++)
       {
-        rowVector[col] = augMatrix[col][i];
+        sum += rowI[k] * y[k];
       }
+      y[i] = (y[i] - sum) / rowI[i];
     }
+  }
 
-    for(int j = i + 1; j < augMatrix.getRow(); j++)
+  // L^T x = y, column i of L^T is row i of L so it is walked contiguously
+  for(int i = n - 1; i >= 0; i--)
+  {
+    const int first = (i - band > 0 ? i - band : 0);
+    const T* rowI = l + i * width + band - i;
+    for(int c = 0; c < count; c++)
     {
-      double co_ef;
-      co_ef = augMatrix[i][j] / rowVector[i];
+      T* y = x + c * ldx;
+      y[i] /= rowI[i];
+      for(int k = first; k < i; k++)
+      {
+        y[k] -= rowI[k] * y[i];
+      }
+    }
+  }
+}
+
+template<typename T>
+void GaussianSolver<T>::factor(SkylineSymMatrix<T>& L)
+{
+  const int n = L.getRow();
 
-      for(int col = i; col < augMatrix.getCol(); col++)
+  // Fill stays right of each row's first entry, so row i only meets row j
+  // from the later of their two first cols on
+  for(int i = 0; i < n; i++)
+  {
+    const int first = L.getFirst(i);
+    T* rowI = L.rowData(i);
+    for(int j = first; j <= i; j++)
+    {
+      const T* rowJ = L.rowData(j);
+      const int start = (L.getFirst(j) > first ? L.getFirst(j) : first);
+      T sum = 0;
+      for(int k = start; k < j; k++)
+      {
+        sum += rowI[k] * rowJ[k];
+      }
+      if(i == j)
       {
-        augMatrix[col][j] -= co_ef * rowVector[col];
-        if(augMatrix[col][j] < EPSILON && augMatrix[col][j] > -EPSILON)
+        if(rowI[i] - sum <= 0)
         {
-          augMatrix[col][j] = 0;
+          std::cerr << "Skyline matrix is not positive definite" << std::endl;
+          throw std::runtime_error("NOT POSITIVE DEFINITE; SKYLINE");
         }
+        rowI[i] = std::sqrt(rowI[i] - sum);
+      }
+      else
+      {
+        rowI[j] = (rowI[j] - sum) / rowJ[j];
       }
     }
   }
+}
+
+template<typename T>
+void GaussianSolver<T>::substitute(const SkylineSymMatrix<T>& L, T* x, const int count,
+                                   const int ldx)
+{
+  const int n = L.getRow();
 
-  for(int i = augMatrix.getRow() - 1; i >= 0; i--)
+  // L y = B
+  for(int i = 0; i < n; i++)
   {
-    double sum = 0;
-    double sumCheck = 0;
-    for(int j = i + 1; j <= augMatrix.getRow() - 1; j++)
+    const int first = L.getFirst(i);
+    const T* rowI = L.rowData(i);
+    for(int c = 0; c < count; c++)
     {
-      sum += augMatrix[j][i] * x[j];
+      T* y = x + c * ldx;
+      T sum = 0;
+      for(int k = first; k < i; k++)
+      {
+        sum += rowI[k] * y[k];
+      }
+      y[i] = (y[i] - sum) / rowI[i];
     }
-    sum = augMatrix[augMatrix.getCol()-1][i] - sum;
-    sumCheck = sum / static_cast<double>(augMatrix[i][i]);
-    x[i] = ((sumCheck < EPSILON && sumCheck > -EPSILON) ? 0 : sumCheck);
   }
 
-  return x;
+  // L^T x = y, column i of L^T is row i of L so it is walked contiguously
+  for(int i = n - 1; i >= 0; i--)
+  {
+    const int first = L.getFirst(i);
+    const T* rowI = L.rowData(i);
+    for(int c = 0; c < count; c++)
+    {
+      T* y = x + c * ldx;
+      y[i] /= rowI[i];
+      for(int k = first; k < i; k++)
+      {
+        y[k] -= rowI[k] * y[i];
+      }
+    }
+  }
 }
 
 template<typename T>
 vector<T> GaussianSolver<T>::operator()(const UpperTriangle<T>& source,
                                         const vector<T>& B) const
 {
-  if(source.getRow() != B.getSize())
+  if(source.getRow() != B.getSize() || source.getRow() != source.getCol())
   {
-    std::cerr << "Upper row size does not match vector size" << std::endl;
+    std::cerr << "Upper row size does not match vector size or it is not square" << std::endl;
     throw std::out_of_range("Upper row size does not match vector size");
   }
 
-  vector<T> x(source.getRow());
-
-  for(int i = source.getRow() - 1; i >= 0; i--)
+  vector<T> x(B);
+  tpsv(UPPER_TRIANGLE, NO_TRANSPOSE, x.getSize(), source.column(0), x.data());
+  for(int i = 0; i < x.getSize(); i++)
   {
-    double sum = 0;
-    double sumCheck = 0;
-    for(int j = i + 1; j <= source.getRow() - 1; j++)
-    {
-      sum += source(j, i) * x[j];
-    }
-    sum = B[i] - sum;
-    sumCheck = sum / static_cast<double>(source(i, i));
-    x[i] = ((sumCheck < EPSILON && sumCheck > -EPSILON) ? 0 : sumCheck);
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
   }
 
   return x;
@@ -135,25 +248,17 @@ template<typename T>
 vector<T> GaussianSolver<T>::operator()(const LowerTriangle<T>& source,
                                         const vector<T>& B) const
 {
-  if(source.getRow() != B.getSize())
+  if(source.getRow() != B.getSize() || source.getRow() != source.getCol())
   {
-    std::cerr << "Upper row size does not match vector size" << std::endl;
+    std::cerr << "Lower row size does not match vector size or it is not square" << std::endl;
     throw std::out_of_range("Upper row size does not match vector size");
   }
 
-  vector<T> x(source.getRow());
-
-  for(int i = 0; i < source.getRow(); i++)
+  vector<T> x(B);
+  tpsv(LOWER_TRIANGLE, NO_TRANSPOSE, x.getSize(), source.column(0), x.data());
+  for(int i = 0; i < x.getSize(); i++)
   {
-    double sum = 0;
-    double sumCheck = 0;
-    for(int j = 0; j < i; j++)
-    {
-      sum += source(j, i) * x[j];
-    }
-    sum = B[i] - sum;
-    sumCheck = sum / static_cast<double>(source(i, i));
-    x[i] = ((sumCheck < EPSILON && sumCheck > -EPSILON) ? 0 : sumCheck);
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
   }
 
   return x;
@@ -169,24 +274,17 @@ vector<T> GaussianSolver<T>::operator()(const SymMatrix<T>& source,
     throw std::out_of_range("SYM ROW SIZE DOES NOT MATCH VECTOR SIZE");
   }
 
-  LowerTriangle<T> temp(source.getRow(), source.getCol());
-
-  const double NSIZE = sqrt(source.getRow()) + 2;
-
-  for(int k = 0; k < source.getRow(); k++)
+  // Cholesky stops at the first pivot that is not positive, an indefinite
+  // A then goes through LDL^T, which still halves the work of LU
+  const CholeskyFactor<T> factor(source);
+  vector<T> x = (factor.isPositiveDefinite() ? factor.solve(B)
+                                              : LDLTFactorization<T>(source).solve(B));
+  for(int i = 0; i < x.getSize(); i++)
   {
-    for(int i = 0; i <= k; i++)
-    {
-      double sum = 0;
-      for(int j = static_cast<int>(i-NSIZE >= 0 ? i-NSIZE : 0); j < i; j++)
-      {
-        sum += temp(j, i) * temp(j, k);
-      }
-      temp(i, k) = (i == k) ? sqrt(source(k, k) - sum) : (source(i, k) - sum) / temp(i, i);
-    }
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
   }
 
-  return this->operator()(transpose(temp), this->operator()(temp, B));
+  return x;
 }
 
 template<typename T>
@@ -198,26 +296,271 @@ vector<T> GaussianSolver<T>::operator()(const TriDiag<T>& source, const vector<T
     throw std::out_of_range("TRI ROW SIZE DOES NOT MATCH VECTOR SIZE");
   }
 
-  TriDiag<T> temp(source);
-  vector<T> tempVec(B);
-  vector<T> x(B.getSize());
+  vector<T> x(B);
+  substitute(source, x.data(), 1, x.getSize());
 
-  for(int i = 1; i < source.getRow(); i++)
+  return x;
+}
+
+template<typename T>
+vector<T> GaussianSolver<T>::operator()(const BandSymMatrix<T>& source,
+                                        const vector<T>& B) const
+{
+  if(source.getRow() != B.getSize())
   {
-    // Ai = Ai/Bi-1
-    temp(i - 1, i) /= temp(i - 1, i - 1);
-    // Bi = Bi - Ai * Ci-1
-    temp(i, i) -= temp(i - 1, i) * temp(i , i - 1);
-    // Ri = Ri  Ai * Ri-1
-    tempVec[i] -= temp(i - 1, i) * tempVec[i - 1];
+    std::cerr << "Band row size does not match vector size" << std::endl;
+    throw std::out_of_range("BAND ROW SIZE DOES NOT MATCH VECTOR SIZE");
+  }
+
+  BandSymMatrix<T> temp(source);
+  factor(temp);
+
+  vector<T> x(B);
+  substitute(temp, x.data(), 1, x.getSize());
+
+  return x;
+}
+
+template<typename T>
+vector<T> GaussianSolver<T>::operator()(const SkylineSymMatrix<T>& source,
+                                        const vector<T>& B) const
+{
+  if(source.getRow() != B.getSize())
+  {
+    std::cerr << "Skyline row size does not match vector size" << std::endl;
+    throw std::out_of_range("SKYLINE ROW SIZE DOES NOT MATCH VECTOR SIZE");
+  }
+
+  SkylineSymMatrix<T> temp(source);
+  factor(temp);
+
+  vector<T> x(B);
+  substitute(temp, x.data(), 1, x.getSize());
+
+  return x;
+}
+
+template<typename T>
+template<class Layout>
+DenseMatrix<T> GaussianSolver<T>::operator()(const DenseMatrix<T, Layout>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Matrix B rows do not match Matrix row size." << std::endl;
+    throw std::out_of_range("MISS MATCHING MATRIX SIZES");
+  }
+
+  DenseMatrix<T> X = LUFactorization<T>(source).solve(B);
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const UpperTriangle<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Upper row size does not match matrix B rows or it is not square" << std::endl;
+    throw std::out_of_range("UPPER ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  DenseMatrix<T> X(B);
+  tpsm(UPPER_TRIANGLE, NO_TRANSPOSE, X.getRow(), source.column(0),
+       X.getCol(), X.data(), X.getLd());
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const LowerTriangle<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Lower row size does not match matrix B rows or it is not square" << std::endl;
+    throw std::out_of_range("LOWER ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  DenseMatrix<T> X(B);
+  tpsm(LOWER_TRIANGLE, NO_TRANSPOSE, X.getRow(), source.column(0),
+       X.getCol(), X.data(), X.getLd());
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const SymMatrix<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow())
+  {
+    std::cerr << "Sym row size does not match matrix B rows" << std::endl;
+    throw std::out_of_range("SYM ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  const CholeskyFactor<T> factor(source);
+  DenseMatrix<T> X = (factor.isPositiveDefinite() ? factor.solve(B)
+                                                   : LDLTFactorization<T>(source).solve(B));
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const TriDiag<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow())
+  {
+    std::cerr << "Tri row size does not match matrix B rows" << std::endl;
+    throw std::out_of_range("TRI ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  DenseMatrix<T> X(B);
+  substitute(source, X.data(), X.getCol(), X.getLd());
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const BandSymMatrix<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow())
+  {
+    std::cerr << "Band row size does not match matrix B rows" << std::endl;
+    throw std::out_of_range("BAND ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  BandSymMatrix<T> temp(source);
+  factor(temp);
+
+  DenseMatrix<T> X(B);
+  substitute(temp, X.data(), X.getCol(), X.getLd());
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const SkylineSymMatrix<T>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow())
+  {
+    std::cerr << "Skyline row size does not match matrix B rows" << std::endl;
+    throw std::out_of_range("SKYLINE ROW SIZE DOES NOT MATCH MATRIX B ROWS");
   }
 
-  x[x.getSize() - 1] = tempVec[x.getSize() - 1] / temp(x.getSize() -1, x.getSize() - 1);
+  SkylineSymMatrix<T> temp(source);
+  factor(temp);
+
+  DenseMatrix<T> X(B);
+  substitute(temp, X.data(), X.getCol(), X.getLd());
+
+  return X;
+}
+
+template<typename T>
+vector<T> GaussianSolver<T>::operator()(const TransposedView<LowerTriangle<T>>& source,
+                                        const vector<T>& B) const
+{
+  if(source.getRow() != B.getSize() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Transposed lower is not square or its rows do not match vector size" << std::endl;
+    throw std::out_of_range("TRANSPOSED LOWER ROW SIZE DOES NOT MATCH VECTOR SIZE");
+  }
+
+  vector<T> x(B);
+  tpsv(LOWER_TRIANGLE, TRANSPOSE, x.getSize(), source.source().column(0), x.data());
+  for(int i = 0; i < x.getSize(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return x;
+}
+
+template<typename T>
+vector<T> GaussianSolver<T>::operator()(const TransposedView<UpperTriangle<T>>& source,
+                                        const vector<T>& B) const
+{
+  if(source.getRow() != B.getSize() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Transposed upper is not square or its rows do not match vector size" << std::endl;
+    throw std::out_of_range("TRANSPOSED UPPER ROW SIZE DOES NOT MATCH VECTOR SIZE");
+  }
 
-  for(int i = source.getRow() - 2; i >= 0; i--)
+  vector<T> x(B);
+  tpsv(UPPER_TRIANGLE, TRANSPOSE, x.getSize(), source.source().column(0), x.data());
+  for(int i = 0; i < x.getSize(); i++)
   {
-    x[i] = (tempVec[i] - temp(i + 1, i) * x[i + 1]) / temp(i, i);
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
   }
 
   return x;
-}
\ No newline at end of file
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const TransposedView<LowerTriangle<T>>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Transposed lower is not square or its rows do not match matrix B rows" << std::endl;
+    throw std::out_of_range("TRANSPOSED LOWER ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  DenseMatrix<T> X(B);
+  tpsm(LOWER_TRIANGLE, TRANSPOSE, X.getRow(), source.source().column(0),
+       X.getCol(), X.data(), X.getLd());
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
+
+template<typename T>
+DenseMatrix<T> GaussianSolver<T>::operator()(const TransposedView<UpperTriangle<T>>& source,
+                                             const DenseMatrix<T>& B) const
+{
+  if(source.getRow() != B.getRow() || source.getRow() != source.getCol())
+  {
+    std::cerr << "Transposed upper is not square or its rows do not match matrix B rows" << std::endl;
+    throw std::out_of_range("TRANSPOSED UPPER ROW SIZE DOES NOT MATCH MATRIX B ROWS");
+  }
+
+  DenseMatrix<T> X(B);
+  tpsm(UPPER_TRIANGLE, TRANSPOSE, X.getRow(), source.source().column(0),
+       X.getCol(), X.data(), X.getLd());
+  T* x = X.data();
+  for(int i = 0; i < X.getLd() * X.getCol(); i++)
+  {
+    x[i] = ((x[i] < EPSILON && x[i] > -EPSILON) ? 0 : x[i]);
+  }
+
+  return X;
+}
@@ -0,0 +1,113 @@
+/**
+  * @file   sor.h
+  * @author Dylan Warren, Section A
+  * @brief  The SOR class is a "functor" class, it solves the five point
+            Poisson system with red-black successive over-relaxation.
+*/
+/**
+  * @class  SORSolver
+  * @brief  SORSolver sweeps the red points ((j + k) even) then the black ones.
+  *         A colour only reads the other colour, so the grid lines of a sweep
+  *         are split across a ThreadPool. The grid carries a ring of zeros
+  *         so the row loops have no branches and vectorise.
+*/
+#ifndef SOR_H
+#define SOR_H
+
+#include <memory>
+#include "./poisson.h"
+#include "./threadpool.h"
+
+/** Norm ||B - A x|| / ||B|| is measured in to decide convergence */
+enum ResidualNorm
+{
+  L2_NORM = 0,
+  MAX_NORM = 1
+};
+
+template<class T>
+class SORSolver
+{
+  private:
+    T m_omega;
+    T m_tolerance;
+    int m_maxSweeps;
+    int m_norm;
+    int m_sweeps;
+    T m_residual;
+    std::unique_ptr<ThreadPool> m_pool;
+    /**
+      * @brief   Over-relaxes every point of one colour
+      * @pre     u is the padded grid, f the unpadded right hand side
+      * @post    The colour points of u are updated
+      * @param   u - (N+1)^2 grid, first interior point at N+2
+      * @param   f - (N-1)^2 right hand side
+      * @param   line - Points on one grid line, N-1
+      * @param   omega - Relaxation factor
+      * @param   colour - 0 for red, 1 for black
+      * @return  None
+    */
+    void sweep(T* u, const T* f, const int line, const T omega, const int colour);
+    /**
+      * @brief   Measures B - A x in m_norm
+      * @pre     u is the padded grid, f the unpadded right hand side
+      * @post    None
+      * @param   u - (N+1)^2 grid, first interior point at N+2
+      * @param   f - (N-1)^2 right hand side
+      * @param   line - Points on one grid line, N-1
+      * @return  The norm of the residual
+    */
+    T residualNorm(const T* u, const T* f, const int line);
+  public:
+    /**
+      * @brief   Sets the relaxation, when the solver stops and the threads
+      * @pre     omega must be 0 or in (0, 2), tolerance positive and the
+                  counts not negative
+      * @post    Creates a solver and starts its threads
+      * @param   omega - Relaxation factor, 0 means the optimal 2 / (1 + sin(pi / N))
+      * @param   tolerance - Stop once ||B - A x|| / ||B|| is below this
+      * @param   maxSweeps - Most red and black sweep pairs, 0 means 20 N
+      * @param   norm - ResidualNorm the tolerance is checked in
+      * @param   threads - Threads to sweep with, 0 means one per core
+      * @return  None
+      * @throw   If any of the settings are out of range
+    */
+    SORSolver(const T omega = 0, const T tolerance = static_cast<T>(1e-10),
+              const int maxSweeps = 0, const int norm = L2_NORM,
+              const int threads = 0);
+    /**
+      * @brief   Solves A x = B for the five point operator A starting at x = 0
+      * @pre     B must come from PartialDiff::makeRHS with the same N as A
+      * @post    getSweeps and getResidual describe this solve
+      * @param   A - The operator of the mesh
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector, the last iterate if it never converged
+      * @throw   If B does not match the size of A
+    */
+    vector<T> operator()(const PoissonOperator<T>& A, const vector<T>& B);
+    /**
+      * @brief   Gets how many sweep pairs the last solve took
+      * @pre     None
+      * @post    None
+      * @return  m_sweeps
+    */
+    int getSweeps() const { return m_sweeps; }
+    /**
+      * @brief   Gets ||B - A x|| / ||B|| from the end of the last solve
+      * @pre     None
+      * @post    None
+      * @return  m_residual
+    */
+    T getResidual() const { return m_residual; }
+    /**
+      * @brief   Checks if the last solve reached the tolerance
+      * @pre     None
+      * @post    None
+      * @return  True if the final residual is under the tolerance
+    */
+    bool converged() const { return m_residual <= m_tolerance; }
+};
+
+#include "./sor.hpp"
+
+#endif
@@ -0,0 +1,183 @@
+/**
+  * @file   sor.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the () operator and sweeps of SORSolver
+*/
+#include <exception>
+#include <stdexcept>
+#include <cmath>
+
+template<typename T>
+SORSolver<T>::SORSolver(const T omega, const T tolerance, const int maxSweeps,
+                        const int norm, const int threads)
+{
+  if(norm < L2_NORM || norm > MAX_NORM)
+  {
+    throw std::out_of_range("Unknown residual norm given");
+  }
+  if(omega < 0 || omega >= 2 || tolerance <= 0 || maxSweeps < 0 || threads < 0)
+  {
+    std::cerr << "Bad SOR settings" << std::endl;
+    throw std::out_of_range("BAD SETTINGS; SOR");
+  }
+
+  m_omega = omega;
+  m_tolerance = tolerance;
+  m_maxSweeps = maxSweeps;
+  m_norm = norm;
+  m_sweeps = 0;
+  m_residual = 0;
+  m_pool.reset(new ThreadPool(threads));
+}
+
+template<typename T>
+vector<T> SORSolver<T>::operator()(const PoissonOperator<T>& A, const vector<T>& B)
+{
+  if(A.getRow() != B.getSize())
+  {
+    std::cerr << "SOR operator size does not match vector size" << std::endl;
+    throw std::out_of_range("OPERATOR SIZE DOES NOT MATCH VECTOR SIZE; SOR");
+  }
+
+  const int N = A.getPartitions();
+  const int line = N - 1;
+  const int pitch = N + 1;
+  const int maxSweeps = (m_maxSweeps > 0 ? m_maxSweeps : 20 * N);
+
+  // Jacobi for this A has spectral radius cos(pi / N), which gives the
+  // optimal omega 2 / (1 + sqrt(1 - cos^2)) = 2 / (1 + sin(pi / N))
+  const T PI = static_cast<T>(3.14159265358979323846264338327950288L);
+  const T omega = (m_omega > 0 ? m_omega
+                   : 2 / (1 + std::sin(PI / static_cast<T>(N))));
+
+  vector<T> grid(pitch * pitch);
+  T* u = grid.data();
+  const T* f = B.data();
+
+  T bNorm = 0;
+  for(int i = 0; i < B.getSize(); i++)
+  {
+    if(m_norm == MAX_NORM)
+    {
+      bNorm = (std::abs(f[i]) > bNorm ? std::abs(f[i]) : bNorm);
+    }
+    else
+    {
+      bNorm += f[i] * f[i];
+    }
+  }
+  if(m_norm == L2_NORM)
+  {
+    bNorm = std::sqrt(bNorm);
+  }
+
+  vector<T> x(B.getSize());
+  m_sweeps = 0;
+  m_residual = 0;
+  if(bNorm == 0)
+  {
+    return x;
+  }
+
+  m_residual = 1;
+  while(m_sweeps < maxSweeps && m_residual > m_tolerance)
+  {
+    sweep(u, f, line, omega, 0);
+    sweep(u, f, line, omega, 1);
+    m_sweeps++;
+    m_residual = residualNorm(u, f, line) / bNorm;
+  }
+
+  T* xp = x.data();
+  for(int k = 0; k < line; k++)
+  {
+    const T* uk = u + (k + 1) * pitch + 1;
+    for(int j = 0; j < line; j++)
+    {
+      xp[k * line + j] = uk[j];
+    }
+  }
+
+  return x;
+}
+
+template<typename T>
+void SORSolver<T>::sweep(T* u, const T* f, const int line, const T omega,
+                         const int colour)
+{
+  const int pitch = line + 2;
+  const T keep = 1 - omega;
+  const T quarter = static_cast<T>(0.25) * omega;
+
+  m_pool->parallelFor(0, line, [&](const int first, const int last)
+  {
+    for(int k = first; k < last; k++)
+    {
+      T* uk = u + (k + 1) * pitch + 1;
+      const T* below = uk - pitch;
+      const T* above = uk + pitch;
+      const T* fk = f + k * line;
+      for(int j = (k + colour) % 2; j < line; j += 2)
+      {
+        uk[j] = keep * uk[j] + omega * fk[j]
+              + quarter * (uk[j - 1] + uk[j + 1] + below[j] + above[j]);
+      }
+    }
+  });
+}
+
+template<typename T>
+T SORSolver<T>::residualNorm(const T* u, const T* f, const int line)
+{
+  const int pitch = line + 2;
+  const int parts = m_pool->getThreads();
+  vector<T> partial(parts);
+  T* sums = partial.data();
+  const bool maxNorm = (m_norm == MAX_NORM);
+
+  // One partial result a thread, combined after the loop
+  m_pool->parallelFor(0, parts, [&](const int first, const int last)
+  {
+    for(int p = first; p < last; p++)
+    {
+      T total = 0;
+      const int kEnd = static_cast<int>(static_cast<long long>(line) * (p + 1) / parts);
+      for(int k = static_cast<int>(static_cast<long long>(line) * p / parts); k < kEnd; k++)
+      {
+        const T* uk = u + (k + 1) * pitch + 1;
+        const T* below = uk - pitch;
+        const T* above = uk + pitch;
+        const T* fk = f + k * line;
+        for(int j = 0; j < line; j++)
+        {
+          const T r = fk[j] - uk[j]
+                    + static_cast<T>(0.25) * (uk[j - 1] + uk[j + 1] + below[j] + above[j]);
+          if(maxNorm)
+          {
+            total = (std::abs(r) > total ? std::abs(r) : total);
+          }
+          else
+          {
+            total += r * r;
+          }
+        }
+      }
+      sums[p] = total;
+    }
+  });
+
+  T norm = 0;
+  for(int p = 0; p < parts; p++)
+  {
+    if(maxNorm)
+    {
+      norm = (sums[p] > norm ? sums[p] : norm);
+    }
+    else
+    {
+      norm += sums[p];
+    }
+  }
+
+  return (maxNorm ? norm : std::sqrt(norm));
+}
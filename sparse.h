@@ -0,0 +1,199 @@
+/**
+  * @file   sparse.h
+  * @author Dylan Warren, Section A
+  * @brief  The sparse class is a compressed sparse row (CSR) matrix.
+*/
+/**
+  * @class  SparseMatrix
+  * @brief  SparseMatrix only stores the non zero entries of each row. It can
+  *         keep just the lower triangle when the matrix is symmetric.
+*/
+
+#ifndef SPARSE_H
+#define SPARSE_H
+
+#include "./matrix.h"
+
+template<class T>
+class SparseMatrix : public matrix<SparseMatrix<T>, T>
+{
+  private:
+    int m_rows;
+    int m_cols;
+    int m_nonZeros;
+    int m_filledRows;
+    bool m_symmetric;
+    vector<int> m_rowStart;
+    vector<int> m_colIndex;
+    vector<T> m_values;
+  public:
+    /**
+      * @brief   Sets row and col to 0 and leaves the storage empty
+      * @pre     None
+      * @post    All member variables are set.
+      * @return  None
+    */
+    SparseMatrix() : m_rows(0), m_cols(0), m_nonZeros(0), m_filledRows(0),
+                     m_symmetric(false) {};
+    /**
+      * @brief   Confirms SparseMatrix row and col are proper values then makes
+                  room for capacity entries. Rows are filled with append and
+                  closed with closeRow, in order.
+      * @pre     r, c and capacity must be greater than zero
+      * @post    Creates an empty SparseMatrix of size r and c
+      * @param   r - How tall the SparseMatrix should be
+      * @param   c - How wide the SparseMatrix should be
+      * @param   capacity - Most entries that will be appended
+      * @param   symmetric - Only the lower triangle (col <= row) is stored
+      * @return  None
+      * @throw   If r, c or capacity is 0 or less
+    */
+    SparseMatrix(const int r, const int c, const int capacity,
+                 const bool symmetric = false);
+    /**
+      * @brief   Copies source into a new SparseMatrix
+      * @pre     None
+      * @post    Creates a new SparseMatrix object that is identical to source
+      * @param   source - SparseMatrix to copy
+      * @return  None
+    */
+    SparseMatrix(const SparseMatrix& source) = default;
+    /**
+      * @brief   Moves other's data into a new SparseMatrix
+      * @pre     None
+      * @post    Moves other's data into C.O
+      * @param   other - SparseMatrix to move
+      * @return  None
+    */
+    SparseMatrix(SparseMatrix&& other) = default;
+    /**
+      * @brief   Copies content from rhs into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   rhs - The SparseMatrix to copy
+      * @return  *this as the C.O is being altered
+    */
+    SparseMatrix& operator=(const SparseMatrix& rhs) = default;
+    /**
+      * @brief   Move content from other into the calling object
+      * @pre     None
+      * @post    The C.O is identical to the source
+      * @param   other - the SparseMatrix to move
+      * @return  *this as the C.O is being altered
+    */
+    SparseMatrix& operator=(SparseMatrix&& other) = default;
+    /**
+      * @brief   Adds an entry to the row currently being filled
+      * @pre     col must be larger than the last col appended to this row
+      * @post    The entry is stored
+      * @param   col - column of the entry
+      * @param   value - value of the entry
+      * @return  None
+      * @throw   If col is out of bounds, out of order, above the diagonal of
+                  a symmetric matrix or there is no room left
+    */
+    void append(const int col, const T value);
+    /**
+      * @brief   Finishes the row currently being filled and starts the next
+      * @pre     Not every row has been closed yet
+      * @post    The next append goes into the following row
+      * @return  None
+      * @throw   If every row is already closed
+    */
+    void closeRow();
+    /**
+      * @brief   Allows access to matrix elements.
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @param   row - row of the matrix
+      * @return  Value stored at col, row or 0 if nothing is stored there
+      * @throw   IF col or row are out of bounds
+    */
+    T operator()(const int col, const int row) const;
+    /**
+      * @brief   Gets the SparseMatrix row size
+      * @pre     None
+      * @post    None
+      * @return  m_rows
+    */
+    int getRow() const { return m_rows; }
+    /**
+      * @brief   Gets the SparseMatrix col size
+      * @pre     None
+      * @post    None
+      * @return  m_cols
+    */
+    int getCol() const { return m_cols; }
+    /**
+      * @brief   Gets how many entries are stored
+      * @pre     None
+      * @post    None
+      * @return  m_nonZeros
+    */
+    int getNonZeros() const { return m_nonZeros; }
+    /**
+      * @brief   Checks if only the lower triangle is stored
+      * @pre     None
+      * @post    None
+      * @return  m_symmetric
+    */
+    bool isSymmetric() const { return m_symmetric; }
+    /**
+      * @brief   Gets where every row starts in colIndex and values, the
+                  entry after the last row holds getNonZeros()
+      * @pre     Every row has been closed
+      * @post    None
+      * @return  Pointer to m_rows + 1 offsets
+    */
+    const int* rowStart() const { return m_rowStart.data(); }
+    /**
+      * @brief   Gets the column of every stored entry, row by row
+      * @pre     None
+      * @post    None
+      * @return  Pointer to getNonZeros() columns
+    */
+    const int* colIndex() const { return m_colIndex.data(); }
+    /**
+      * @brief   Gets the value of every stored entry, row by row
+      * @pre     None
+      * @post    None
+      * @return  Pointer to getNonZeros() values
+    */
+    const T* values() const { return m_values.data(); }
+    /**
+      * @brief   Allows the stored values to be changed without changing
+                  the sparsity pattern
+      * @pre     None
+      * @post    The values may be changed through the pointer
+      * @return  Pointer to getNonZeros() values
+    */
+    T* values() { return m_values.data(); }
+};
+
+/**
+  * @brief   Multiply a SparseMatrix by a vector
+  * @pre     Vector size must match SparseMatrix cols
+  * @post    None
+  * @param   lhs - The SparseMatrix to multiply
+  * @param   rhs - vector to multiply by
+  * @return  New vector
+  * @throw   If vector size doesn't match SparseMatrix m_cols
+*/
+template<typename T>
+vector<T> operator*(const SparseMatrix<T>& lhs, const vector<T>& rhs);
+
+/**
+  * @brief   Displays the entries of the SparseMatrix
+  * @pre     None
+  * @post    Displays the SparseMatrix
+  * @param   out - ostream object used to display the SparseMatrix
+  * @param   m - SparseMatrix object to read data in from
+  * @return  The modified ostream object
+*/
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const SparseMatrix<T>& m);
+
+#include "./sparse.hpp"
+
+#endif
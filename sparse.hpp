@@ -0,0 +1,194 @@
+/**
+  * @file   sparse.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Implements SparseMatrix operators
+*/
+
+#include <exception>
+
+template<typename T>
+SparseMatrix<T>::SparseMatrix(const int r, const int c, const int capacity,
+                              const bool symmetric)
+{
+  if(r <= 0 || c <= 0 || capacity <= 0)
+  {
+    std::cerr << "Row, Cols or capacity set less than one; Sparse" << std::endl;
+    throw std::out_of_range("Tried to set illegal bounds of SparseMatrix");
+  }
+  if(symmetric && r != c)
+  {
+    std::cerr << "Symmetric storage needs a square matrix; Sparse" << std::endl;
+    throw std::out_of_range("NON SQUARE SYMMETRIC SPARSE");
+  }
+
+  m_rows = r;
+  m_cols = c;
+  m_nonZeros = 0;
+  m_filledRows = 0;
+  m_symmetric = symmetric;
+
+  m_rowStart = vector<int>(m_rows + 1);
+  m_colIndex = vector<int>(capacity);
+  m_values = vector<T>(capacity);
+
+  for(int i = 0; i <= m_rows; i++)
+  {
+    m_rowStart[i] = 0;
+  }
+}
+
+template<typename T>
+void SparseMatrix<T>::append(const int col, const T value)
+{
+  if(m_filledRows >= m_rows)
+  {
+    std::cerr << "Every row is already closed; Sparse" << std::endl;
+    throw std::out_of_range("SPARSE IS FULL");
+  }
+  if(col < 0 || col >= m_cols || (m_symmetric && col > m_filledRows))
+  {
+    std::cerr << "Column out of bounds for this row; Sparse" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; SPARSE");
+  }
+  if(m_nonZeros > m_rowStart[m_filledRows] && m_colIndex[m_nonZeros-1] >= col)
+  {
+    std::cerr << "Columns must be appended in order; Sparse" << std::endl;
+    throw std::out_of_range("COLUMN OUT OF ORDER; SPARSE");
+  }
+  if(m_nonZeros >= m_values.getSize())
+  {
+    std::cerr << "No room left for another entry; Sparse" << std::endl;
+    throw std::out_of_range("CAPACITY REACHED; SPARSE");
+  }
+
+  m_colIndex[m_nonZeros] = col;
+  m_values[m_nonZeros] = value;
+  m_nonZeros++;
+}
+
+template<typename T>
+void SparseMatrix<T>::closeRow()
+{
+  if(m_filledRows >= m_rows)
+  {
+    std::cerr << "Every row is already closed; Sparse" << std::endl;
+    throw std::out_of_range("SPARSE IS FULL");
+  }
+
+  m_filledRows++;
+  m_rowStart[m_filledRows] = m_nonZeros;
+}
+
+template<typename T>
+T SparseMatrix<T>::operator()(const int col, const int row) const
+{
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+  {
+    std::cerr << "Out of bounds (); Sparse" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS");
+  }
+
+  int r = row;
+  int c = col;
+  if(m_symmetric && c > r)
+  {
+    r = col;
+    c = row;
+  }
+  if(r >= m_filledRows)
+  {
+    return 0;
+  }
+
+  // Columns are sorted within a row, so binary search them.
+  int low = m_rowStart[r];
+  int high = m_rowStart[r + 1] - 1;
+  while(low <= high)
+  {
+    const int mid = (low + high) / 2;
+    if(m_colIndex[mid] == c)
+    {
+      return m_values[mid];
+    }
+    if(m_colIndex[mid] < c)
+    {
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid - 1;
+    }
+  }
+
+  return 0;
+}
+
+template<typename T>
+vector<T> operator*(const SparseMatrix<T>& lhs, const vector<T>& rhs)
+{
+  if(lhs.getCol() != rhs.getSize())
+  {
+    std::cerr << "Vector size and SparseMatrix col size do not match" << std::endl;
+    throw std::out_of_range("MISMATCHED VECTOR SIZE AND MATRIX COL SIZE");
+  }
+
+  vector<T> temp(lhs.getRow());
+  const int* start = lhs.rowStart();
+  const int* cols = lhs.colIndex();
+  const T* vals = lhs.values();
+  const T* x = rhs.data();
+  T* y = temp.data();
+
+  if(!lhs.isSymmetric())
+  {
+    for(int i = 0; i < lhs.getRow(); i++)
+    {
+      T sum = 0;
+      for(int k = start[i]; k < start[i + 1]; k++)
+      {
+        sum += vals[k] * x[cols[k]];
+      }
+      y[i] = sum;
+    }
+
+    return temp;
+  }
+
+  // Only col <= row is stored, every off diagonal entry also lands in y[col].
+  for(int i = 0; i < lhs.getRow(); i++)
+  {
+    y[i] = 0;
+  }
+  for(int i = 0; i < lhs.getRow(); i++)
+  {
+    T sum = 0;
+    const T xi = x[i];
+    for(int k = start[i]; k < start[i + 1]; k++)
+    {
+      const int j = cols[k];
+      sum += vals[k] * x[j];
+      if(j != i)
+      {
+        y[j] += vals[k] * xi;
+      }
+    }
+    y[i] += sum;
+  }
+
+  return temp;
+}
+
+template<typename T>
+std::ostream& operator<<(std::ostream& out, const SparseMatrix<T>& m)
+{
+  for(int i = 0; i < m.getRow(); i++)
+  {
+    for(int j = 0; j < m.getCol(); j++)
+    {
+      out << m(j, i) << " ";
+    }
+    out << std::endl;
+  }
+
+  return out;
+}
@@ -0,0 +1,161 @@
+/**
+  * @file   sparsecholesky.h
+  * @author Dylan Warren, Section A
+  * @brief  Supernodal Cholesky factorization of a sparse symmetric positive
+            definite matrix, P A P^T = L L^T.
+*/
+/**
+  * @class  SparseCholesky
+  * @brief  SparseCholesky works in two phases. The symbolic phase permutes
+  *         A, builds the elimination tree, counts the entries of every
+  *         column of L and groups columns with the same pattern into
+  *         supernodes. The numeric phase fills each supernode as one dense
+  *         column major block. Descendants update it through gemm, then its
+  *         diagonal block is factored with potrf and the rows below are
+  *         solved with trsmRight. factor() reruns only the numeric phase, so
+  *         matrices that share a pattern share the symbolic work.
+*/
+
+#ifndef SPARSECHOLESKY_H
+#define SPARSECHOLESKY_H
+
+#include <stdexcept>
+#include "./sparse.h"
+#include "./ordering.h"
+#include "./blas.h"
+
+/** Ordering SparseCholesky picks by itself when it is not handed one */
+enum OrderingType
+{
+  NATURAL_ORDER = 0,
+  MINIMUM_DEGREE = 1
+};
+
+template<class T>
+class SparseCholesky
+{
+  private:
+    int m_size;
+    // Position k of P A P^T holds old row m_perm[k], old row i sits at
+    // position m_inverse[i]
+    vector<int> m_perm;
+    vector<int> m_inverse;
+    // Elimination tree, -1 marks a root
+    vector<int> m_parent;
+    // Entries of each column of L, the diagonal included
+    vector<int> m_colCount;
+    // Lower half of P A P^T by columns and where each entry sits in A
+    vector<int> m_aStart;
+    vector<int> m_aRow;
+    vector<int> m_aSource;
+    int m_sourceNonZeros;
+    // Supernode s is columns m_superStart[s] .. m_superStart[s + 1] - 1.
+    // Its rows are m_rowIndex[m_rowStart[s] ...], its own columns first,
+    // and its block of L is column major at m_values[m_valueStart[s]].
+    int m_supernodes;
+    vector<int> m_superStart;
+    vector<int> m_columnSuper;
+    vector<int> m_rowStart;
+    vector<int> m_rowIndex;
+    vector<int> m_valueStart;
+    vector<T> m_values;
+    int m_updateSize;
+    /**
+      * @brief   Symbolic phase for the ordering in m_perm
+      * @pre     m_perm holds the ordering
+      * @post    Everything but m_values is set
+      * @param   A - Matrix to analyze
+      * @return  None
+      * @throw   If A is not square or m_perm is not a permutation of its rows
+    */
+    void analyze(const SparseMatrix<T>& A);
+  public:
+    /**
+      * @brief   Orders, analyzes and factors A
+      * @pre     A must be symmetric positive definite
+      * @post    The factor is ready to solve with
+      * @param   A - Matrix in symmetric or general storage
+      * @param   ordering - NATURAL_ORDER or MINIMUM_DEGREE
+      * @return  None
+      * @throw   If A is not square or not positive definite
+    */
+    SparseCholesky(const SparseMatrix<T>& A, const int ordering = MINIMUM_DEGREE);
+    /**
+      * @brief   Analyzes and factors A in the given order, for example
+                  nestedDissection for a grid
+      * @pre     A must be symmetric positive definite
+      * @post    The factor is ready to solve with
+      * @param   A - Matrix in symmetric or general storage
+      * @param   perm - perm[k] is the row of A to eliminate k-th
+      * @return  None
+      * @throw   If A is not square, perm is not a permutation of its rows or
+                  A is not positive definite
+    */
+    SparseCholesky(const SparseMatrix<T>& A, const vector<int>& perm);
+    /**
+      * @brief   Numeric phase only, factors new values on the analyzed pattern
+      * @pre     A must have the same size, storage and pattern as the matrix
+                  that was analyzed
+      * @post    The factor is ready to solve with
+      * @param   A - Matrix with new values
+      * @return  None
+      * @throw   If A does not match the pattern or is not positive definite
+    */
+    void factor(const SparseMatrix<T>& A);
+    /**
+      * @brief   Solves A x = B, one forward and one back substitution by
+                  supernodes
+      * @pre     None
+      * @post    None
+      * @param   B - Vector "B" in the equation
+      * @return  The solved x vector
+      * @throw   If B does not match A
+    */
+    vector<T> solve(const vector<T>& B) const;
+    /**
+      * @brief   Gets the order of A
+      * @pre     None
+      * @post    None
+      * @return  m_size
+    */
+    int getSize() const { return m_size; }
+    /**
+      * @brief   Gets how many entries L holds, the diagonal included
+      * @pre     None
+      * @post    None
+      * @return  Sum of the column counts
+    */
+    long long getFactorNonZeros() const;
+    /**
+      * @brief   Gets how many supernodes the columns fell into
+      * @pre     None
+      * @post    None
+      * @return  m_supernodes
+    */
+    int getSupernodes() const { return m_supernodes; }
+    /**
+      * @brief   Gets the ordering
+      * @pre     None
+      * @post    None
+      * @return  perm[k] is the row of A eliminated k-th
+    */
+    const vector<int>& getPermutation() const { return m_perm; }
+    /**
+      * @brief   Gets the elimination tree of P A P^T
+      * @pre     None
+      * @post    None
+      * @return  Parent of every column, -1 for a root
+    */
+    const vector<int>& getParent() const { return m_parent; }
+    /**
+      * @brief   Gets the entries in every column of L
+      * @pre     None
+      * @post    None
+      * @return  Column counts, the diagonal included
+    */
+    const vector<int>& getColumnCounts() const { return m_colCount; }
+};
+
+#include "./sparsecholesky.hpp"
+
+#endif
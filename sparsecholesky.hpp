@@ -0,0 +1,448 @@
+/**
+  * @file   sparsecholesky.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the symbolic and numeric phases of SparseCholesky
+*/
+#include <cmath>
+
+template<typename T>
+SparseCholesky<T>::SparseCholesky(const SparseMatrix<T>& A, const int ordering)
+{
+  if(ordering == MINIMUM_DEGREE)
+  {
+    m_perm = minimumDegree(A);
+  }
+  else if(ordering == NATURAL_ORDER)
+  {
+    m_perm = vector<int>(A.getRow());
+    for(int k = 0; k < A.getRow(); k++)
+    {
+      m_perm[k] = k;
+    }
+  }
+  else
+  {
+    std::cerr << "Unknown ordering for SparseCholesky" << std::endl;
+    throw std::out_of_range("UNKNOWN ORDERING; SPARSE CHOLESKY");
+  }
+
+  analyze(A);
+  factor(A);
+}
+
+template<typename T>
+SparseCholesky<T>::SparseCholesky(const SparseMatrix<T>& A, const vector<int>& perm)
+  : m_perm(perm)
+{
+  analyze(A);
+  factor(A);
+}
+
+template<typename T>
+void SparseCholesky<T>::analyze(const SparseMatrix<T>& A)
+{
+  if(A.getRow() != A.getCol())
+  {
+    std::cerr << "Cannot Cholesky factor a SparseMatrix that is not square" << std::endl;
+    throw std::out_of_range("MATRIX NOT SQUARE; SPARSE CHOLESKY");
+  }
+  if(m_perm.getSize() != A.getRow())
+  {
+    std::cerr << "Ordering size does not match the SparseMatrix" << std::endl;
+    throw std::out_of_range("BAD PERMUTATION; SPARSE CHOLESKY");
+  }
+
+  const int n = A.getRow();
+  m_size = n;
+  m_sourceNonZeros = A.getNonZeros();
+  m_inverse = inversePermutation(m_perm);
+  const int* inv = m_inverse.data();
+  const int* rowStart = A.rowStart();
+  const int* cols = A.colIndex();
+
+  // Entry (r, c) of A is entry (inv[r], inv[c]) of P A P^T. Symmetric
+  // storage keeps each pair once, general storage keeps the lower copy.
+  auto kept = [&](const int r, const int c)
+  {
+    return A.isSymmetric() || inv[r] >= inv[c];
+  };
+
+  m_aStart = vector<int>(n + 1);
+  int* aStart = m_aStart.data();
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      if(kept(r, cols[k]))
+      {
+        const int i = inv[r];
+        const int j = inv[cols[k]];
+        aStart[(i < j ? i : j) + 1]++;
+      }
+    }
+  }
+  for(int j = 0; j < n; j++)
+  {
+    aStart[j + 1] += aStart[j];
+  }
+
+  const int entries = aStart[n];
+  m_aRow = vector<int>(entries > 0 ? entries : 1);
+  m_aSource = vector<int>(entries > 0 ? entries : 1);
+  vector<int> fill(n);
+  for(int r = 0; r < n; r++)
+  {
+    for(int k = rowStart[r]; k < rowStart[r + 1]; k++)
+    {
+      if(kept(r, cols[k]))
+      {
+        const int i = inv[r];
+        const int j = inv[cols[k]];
+        const int low = (i < j ? i : j);
+        const int at = aStart[low] + fill[low]++;
+        m_aRow[at] = (i < j ? j : i);
+        m_aSource[at] = k;
+      }
+    }
+  }
+
+  // The same entries by rows, row i lists the cols j < i
+  vector<int> lowStart(n + 1);
+  int* ls = lowStart.data();
+  for(int q = 0; q < entries; q++)
+  {
+    ls[m_aRow[q] + 1]++;
+  }
+  for(int i = 0; i < n; i++)
+  {
+    ls[i + 1] += ls[i];
+    fill[i] = 0;
+  }
+  vector<int> lowCol(entries > 0 ? entries : 1);
+  for(int j = 0; j < n; j++)
+  {
+    for(int q = aStart[j]; q < aStart[j + 1]; q++)
+    {
+      const int i = m_aRow[q];
+      lowCol[ls[i] + fill[i]++] = j;
+    }
+  }
+
+  // Elimination tree, Liu's algorithm with path compression
+  m_parent = vector<int>(n);
+  int* parent = m_parent.data();
+  vector<int> ancestor(n);
+  int* anc = ancestor.data();
+  for(int k = 0; k < n; k++)
+  {
+    parent[k] = -1;
+    anc[k] = -1;
+    for(int q = ls[k]; q < ls[k + 1]; q++)
+    {
+      int i = lowCol[q];
+      while(i != -1 && i < k)
+      {
+        const int next = anc[i];
+        anc[i] = k;
+        if(next == -1)
+        {
+          parent[i] = k;
+        }
+        i = next;
+      }
+    }
+  }
+
+  // Row k of L is every node on the paths from the cols of row k of A up
+  // the tree to k, each path stops at a node this row already marked
+  vector<int> marked(n);
+  int* mark = marked.data();
+  auto walkRows = [&](auto visit)
+  {
+    for(int k = 0; k < n; k++)
+    {
+      mark[k] = k;
+      for(int q = ls[k]; q < ls[k + 1]; q++)
+      {
+        for(int i = lowCol[q]; mark[i] != k; i = parent[i])
+        {
+          mark[i] = k;
+          visit(i, k);
+        }
+      }
+    }
+  };
+  for(int k = 0; k < n; k++)
+  {
+    mark[k] = -1;
+  }
+
+  m_colCount = vector<int>(n);
+  int* count = m_colCount.data();
+  for(int j = 0; j < n; j++)
+  {
+    count[j] = 1;
+  }
+  walkRows([&](const int i, const int) { count[i]++; });
+
+  // Fundamental supernodes, j joins j - 1 when j - 1 is its only child and
+  // column j is column j - 1 less its diagonal
+  vector<int> children(n);
+  for(int j = 0; j < n; j++)
+  {
+    if(parent[j] != -1)
+    {
+      children[parent[j]]++;
+    }
+  }
+  m_columnSuper = vector<int>(n);
+  int* columnSuper = m_columnSuper.data();
+  m_supernodes = 0;
+  for(int j = 0; j < n; j++)
+  {
+    const bool joins = (j > 0 && parent[j - 1] == j && count[j - 1] == count[j] + 1
+                        && children[j] == 1);
+    m_supernodes += (joins ? 0 : 1);
+    columnSuper[j] = m_supernodes - 1;
+  }
+
+  m_superStart = vector<int>(m_supernodes + 1);
+  m_rowStart = vector<int>(m_supernodes + 1);
+  m_valueStart = vector<int>(m_supernodes + 1);
+  m_updateSize = 1;
+  for(int j = n - 1; j >= 0; j--)
+  {
+    m_superStart[columnSuper[j]] = j;
+  }
+  m_superStart[m_supernodes] = n;
+  for(int s = 0; s < m_supernodes; s++)
+  {
+    const int width = m_superStart[s + 1] - m_superStart[s];
+    const int rows = count[m_superStart[s]];
+    m_rowStart[s + 1] = m_rowStart[s] + rows;
+    m_valueStart[s + 1] = m_valueStart[s] + rows * width;
+    m_updateSize = ((rows - width) * (rows - width) > m_updateSize
+                    ? (rows - width) * (rows - width) : m_updateSize);
+  }
+
+  // The rows of a supernode are the rows of its first column, which the
+  // row walk visits in increasing order
+  m_rowIndex = vector<int>(m_rowStart[m_supernodes]);
+  vector<int> filled(m_supernodes);
+  for(int s = 0; s < m_supernodes; s++)
+  {
+    m_rowIndex[m_rowStart[s]] = m_superStart[s];
+    filled[s] = 1;
+  }
+  for(int k = 0; k < n; k++)
+  {
+    mark[k] = -1;
+  }
+  walkRows([&](const int i, const int k)
+  {
+    const int s = columnSuper[i];
+    if(m_superStart[s] == i)
+    {
+      m_rowIndex[m_rowStart[s] + filled[s]++] = k;
+    }
+  });
+}
+
+template<typename T>
+void SparseCholesky<T>::factor(const SparseMatrix<T>& A)
+{
+  if(A.getRow() != m_size || A.getCol() != m_size || A.getNonZeros() != m_sourceNonZeros)
+  {
+    std::cerr << "SparseMatrix does not match the analyzed pattern" << std::endl;
+    throw std::out_of_range("PATTERN MISMATCH; SPARSE CHOLESKY");
+  }
+
+  const int n = m_size;
+  const T* source = A.values();
+  m_values = vector<T>(m_valueStart[m_supernodes]);
+  T* values = m_values.data();
+  const int* rowIndex = m_rowIndex.data();
+
+  // Supernodes waiting to update s are linked from head[s], next[d] is the
+  // one after d and d's next rows to apply start at pos[d]
+  vector<int> map(n);
+  vector<int> head(m_supernodes);
+  vector<int> next(m_supernodes);
+  vector<int> pos(m_supernodes);
+  for(int s = 0; s < m_supernodes; s++)
+  {
+    head[s] = -1;
+  }
+  vector<T> update(m_updateSize);
+  T* C = update.data();
+
+  for(int s = 0; s < m_supernodes; s++)
+  {
+    const int first = m_superStart[s];
+    const int last = m_superStart[s + 1] - 1;
+    const int width = last - first + 1;
+    const int rows = m_rowStart[s + 1] - m_rowStart[s];
+    const int* R = rowIndex + m_rowStart[s];
+    T* Ls = values + m_valueStart[s];
+    for(int p = 0; p < rows; p++)
+    {
+      map[R[p]] = p;
+    }
+
+    for(int j = first; j <= last; j++)
+    {
+      T* lj = Ls + (j - first) * rows;
+      for(int q = m_aStart[j]; q < m_aStart[j + 1]; q++)
+      {
+        lj[map[m_aRow[q]]] += source[m_aSource[q]];
+      }
+    }
+
+    // Every d linked here has rows in first .. last, its block times the
+    // transpose of those rows is subtracted from s
+    int d = head[s];
+    head[s] = -1;
+    while(d != -1)
+    {
+      const int dNext = next[d];
+      const int dRows = m_rowStart[d + 1] - m_rowStart[d];
+      const int dWidth = m_superStart[d + 1] - m_superStart[d];
+      const int* Rd = rowIndex + m_rowStart[d];
+      const T* Ld = values + m_valueStart[d];
+      const int p1 = pos[d];
+      int p2 = p1;
+      while(p2 < dRows && Rd[p2] <= last)
+      {
+        p2++;
+      }
+      const int below = dRows - p1;
+      const int inside = p2 - p1;
+
+      gemm(below, inside, dWidth, static_cast<T>(1), Ld + p1, 1, dRows, Ld + p1, dRows, 1,
+           static_cast<T>(0), C, 1, below);
+      for(int c = 0; c < inside; c++)
+      {
+        T* lc = Ls + (Rd[p1 + c] - first) * rows;
+        const T* cc = C + c * below;
+        for(int r = c; r < below; r++)
+        {
+          lc[map[Rd[p1 + r]]] -= cc[r];
+        }
+      }
+
+      pos[d] = p2;
+      if(p2 < dRows)
+      {
+        const int target = m_columnSuper[Rd[p2]];
+        next[d] = head[target];
+        head[target] = d;
+      }
+      d = dNext;
+    }
+
+    if(potrf(width, Ls, rows) != 0)
+    {
+      std::cerr << "SparseMatrix is not positive definite" << std::endl;
+      throw std::runtime_error("NOT POSITIVE DEFINITE; SPARSE CHOLESKY");
+    }
+    if(rows > width)
+    {
+      trsmRight(rows - width, width, Ls, rows, Ls + width, rows);
+      pos[s] = width;
+      const int target = m_columnSuper[R[width]];
+      next[s] = head[target];
+      head[target] = s;
+    }
+  }
+}
+
+template<typename T>
+vector<T> SparseCholesky<T>::solve(const vector<T>& B) const
+{
+  if(B.getSize() != m_size)
+  {
+    std::cerr << "Vector B size does not match the SparseCholesky size." << std::endl;
+    throw std::out_of_range("MISS MATCHING VECTOR AND MATRIX SIZE; SPARSE CHOLESKY");
+  }
+
+  const int n = m_size;
+  vector<T> y(n);
+  T* x = y.data();
+  const T* b = B.data();
+  for(int k = 0; k < n; k++)
+  {
+    x[k] = b[m_perm[k]];
+  }
+
+  const T* values = m_values.data();
+  const int* rowIndex = m_rowIndex.data();
+
+  // L y = P B, the diagonal block then the rows below it
+  for(int s = 0; s < m_supernodes; s++)
+  {
+    const int first = m_superStart[s];
+    const int width = m_superStart[s + 1] - first;
+    const int rows = m_rowStart[s + 1] - m_rowStart[s];
+    const int* R = rowIndex + m_rowStart[s];
+    const T* Ls = values + m_valueStart[s];
+    T* xs = x + first;
+    for(int j = 0; j < width; j++)
+    {
+      const T* lj = Ls + j * rows;
+      xs[j] /= lj[j];
+      for(int i = j + 1; i < width; i++)
+      {
+        xs[i] -= lj[i] * xs[j];
+      }
+      for(int i = width; i < rows; i++)
+      {
+        x[R[i]] -= lj[i] * xs[j];
+      }
+    }
+  }
+
+  // L^T x = y, row j of L^T is column j of L
+  for(int s = m_supernodes - 1; s >= 0; s--)
+  {
+    const int first = m_superStart[s];
+    const int width = m_superStart[s + 1] - first;
+    const int rows = m_rowStart[s + 1] - m_rowStart[s];
+    const int* R = rowIndex + m_rowStart[s];
+    const T* Ls = values + m_valueStart[s];
+    T* xs = x + first;
+    for(int j = width - 1; j >= 0; j--)
+    {
+      const T* lj = Ls + j * rows;
+      T sum = 0;
+      for(int i = j + 1; i < width; i++)
+      {
+        sum += lj[i] * xs[i];
+      }
+      for(int i = width; i < rows; i++)
+      {
+        sum += lj[i] * x[R[i]];
+      }
+      xs[j] = (xs[j] - sum) / lj[j];
+    }
+  }
+
+  vector<T> result(n);
+  for(int k = 0; k < n; k++)
+  {
+    result[m_perm[k]] = x[k];
+  }
+
+  return result;
+}
+
+template<typename T>
+long long SparseCholesky<T>::getFactorNonZeros() const
+{
+  long long total = 0;
+  for(int j = 0; j < m_size; j++)
+  {
+    total += m_colCount[j];
+  }
+
+  return total;
+}
@@ -12,6 +12,9 @@
 #define SYMMETRIC_H
 
 #include "./upper.h"
+#include "./aligned.h"
+#include "./blas.h"
+#include "./sparse.h"
 
 template<typename T>
 class SymMatrix : public matrix<SymMatrix<T>, T>
@@ -19,7 +22,17 @@ class SymMatrix : public matrix<SymMatrix<T>, T>
   private:
     int m_rows;
     int m_cols;
-    vector<vector<T>> ptr_to_data;
+    // Lower triangle packed by column, column col holds rows col .. m_rows - 1
+    AlignedBuffer<T> ptr_to_data;
+    /**
+      * @brief   Finds where a column starts in ptr_to_data
+      * @pre     None
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Index of (col, col)
+    */
+    std::ptrdiff_t offset(const int col) const
+    { return static_cast<std::ptrdiff_t>(col) * m_rows - static_cast<std::ptrdiff_t>(col) * (col - 1) / 2; }
   public:
     /**
       * @brief   Sets row and col to 0 and sets our point to nullptr
@@ -27,16 +40,17 @@ class SymMatrix : public matrix<SymMatrix<T>, T>
       * @post    All member variables are set.
       * @return  None
     */
-    SymMatrix() : m_rows(0), m_cols(0), ptr_to_data(vector<vector<T>>()) {};
+    SymMatrix() : m_rows(0), m_cols(0), ptr_to_data(AlignedBuffer<T>()) {};
     /**
       * @brief   Confirms SymMatrix row and col are proper values
                   then initialises ptr_to_vector
-      * @pre     rows and cols must be greater than zero
+      * @pre     rows and cols must be greater than zero and equal
       * @post    Creates a fresh SymMatrix of size rows and cols
       * @param   r - How tall the SymMatrix should be
       * @param   c - How many vectors wide it should be
       * @return  None
-      * @throw   If r or r is 0 or less
+      * @throw   If r or r is 0 or less, r is not c or the
+                  triangle holds more values than an int counts
     */
     SymMatrix(const int r, const int c);
     /**
@@ -91,6 +105,24 @@ class SymMatrix : public matrix<SymMatrix<T>, T>
       * @throw   If col or row are out of bounds
     */
     T& operator()(const int col, const int row);
+    /**
+      * @brief   Gets the stored part of a column, from the diagonal down. By
+                  symmetry it is also row col from the diagonal right.
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, col), row col + i is at [i]
+    */
+    T* column(const int col) { return ptr_to_data.data() + offset(col); }
+    /**
+      * @brief   Gets the stored part of a column, from the diagonal down. By
+                  symmetry it is also row col from the diagonal right.
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, col), row col + i is at [i]
+    */
+    const T* column(const int col) const { return ptr_to_data.data() + offset(col); }
     /**
       * @brief   Gets the SymMatrix row size
       * @pre     None
@@ -105,6 +137,14 @@ class SymMatrix : public matrix<SymMatrix<T>, T>
       * @return  m_cols
     */
     int getCol() const { return m_cols; }
+    /**
+      * @brief   Converts current SymMatrix into a SparseMatrix
+      * @pre     None
+      * @post    None
+      * @param   symmetric - Only keep the lower triangle
+      * @return  A new SparseMatrix holding the non zero entries
+    */
+    SparseMatrix<T> toSparse(const bool symmetric = true) const;
 };
 
 /**
@@ -144,7 +184,8 @@ template<typename T>
 SymMatrix<T> operator*(const SymMatrix<T>& lhs, const SymMatrix<T>& rhs);
 
 /**
-  * @brief   Multiply a SymMatrix by a vector
+  * @brief   Multiply a SymMatrix by a vector with spmv, each stored entry is
+              read once and used for both of its mirror images
   * @pre     Vector size must match SymMatrix cols
   * @post    None
   * @param   rhs - vector to multiply by 
@@ -8,40 +8,118 @@ SymMatrix<T>::SymMatrix(const int r, const int c)
     throw std::out_of_range("LESS THAN ZERO SIZE SYM");
   }
 
+  if(r != c)
+  {
+    std::cerr << "SymMatrix must be square" << std::endl;
+    throw std::out_of_range("NOT SQUARE; SYM");
+  }
+
   m_rows = r;
   m_cols = c;
 
-  ptr_to_data = vector<vector<T>>(m_cols);
+  ptr_to_data = AlignedBuffer<T>(offset(m_cols));
+}
 
-  int rowReducer = r-1;
+template<typename T>
+T SymMatrix<T>::operator()(const int col, const int row) const
+{
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
+  {
+    std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; SYM");
+  }
 
-  for(int i = 0; i < c; i++)
+  if(row < col)
   {
-    ptr_to_data[i] = vector<T>(r - rowReducer);
-    rowReducer--;
+    return ptr_to_data.data()[offset(row) + col - row];
   }
+
+  return ptr_to_data.data()[offset(col) + row - col];
 }
 
 template<typename T>
-T SymMatrix<T>::operator()(const int col, const int row) const
+T& SymMatrix<T>::operator()(const int col, const int row)
 {
-  if(row > col)
+  if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
   {
-    return ptr_to_data[row][col];
+    std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; SYM");
   }
 
-  return ptr_to_data[col][row];
+  if(row < col)
+  {
+    return ptr_to_data.data()[offset(row) + col - row];
+  }
+
+  return ptr_to_data.data()[offset(col) + row - col];
 }
 
 template<typename T>
-T& SymMatrix<T>::operator()(const int col, const int row)
+SparseMatrix<T> SymMatrix<T>::toSparse(const bool symmetric) const
 {
-  if(row > col)
+  // Rows of the result are spread over every packed column, so the columns
+  // are walked in storage order and each entry is bucketed by its row.
+  // Column col reaches row r >= col below the diagonal and, for general
+  // storage, row col at r, both in rising column order.
+  const T* data = ptr_to_data.data();
+  vector<int> start(m_rows + 1);
+  for(int col = 0; col < m_cols; col++)
   {
-    return ptr_to_data[row][col];
+    const T* a = data + offset(col);
+    for(int r = col; r < m_rows; r++)
+    {
+      if(a[r - col] != 0)
+      {
+        start[r + 1]++;
+        if(!symmetric && r != col)
+        {
+          start[col + 1]++;
+        }
+      }
+    }
+  }
+  for(int i = 0; i < m_rows; i++)
+  {
+    start[i + 1] += start[i];
+  }
+
+  const int nonZeros = start[m_rows];
+  vector<int> cols(nonZeros > 0 ? nonZeros : 1);
+  vector<T> values(nonZeros > 0 ? nonZeros : 1);
+  vector<int> fill(m_rows > 0 ? m_rows : 1);
+  for(int col = 0; col < m_cols; col++)
+  {
+    const T* a = data + offset(col);
+    for(int r = col; r < m_rows; r++)
+    {
+      const T value = a[r - col];
+      if(value != 0)
+      {
+        const int k = start[r] + fill[r]++;
+        cols[k] = col;
+        values[k] = value;
+        if(!symmetric && r != col)
+        {
+          const int m = start[col] + fill[col]++;
+          cols[m] = r;
+          values[m] = value;
+        }
+      }
+    }
+  }
+
+  SparseMatrix<T> SMatrix(m_rows, m_cols, (nonZeros > 0 ? nonZeros : 1), symmetric);
+
+  for(int i = 0; i < m_rows; i++)
+  {
+    for(int k = start[i]; k < start[i + 1]; k++)
+    {
+      SMatrix.append(cols[k], values[k]);
+    }
+    SMatrix.closeRow();
   }
 
-  return ptr_to_data[col][row];
+  return SMatrix;
 }
 
 template<typename T>
@@ -123,22 +201,13 @@ SymMatrix<T> operator*(const SymMatrix<T>& lhs, const SymMatrix<T>& rhs)
 template<typename T>
 vector<T> operator*(const SymMatrix<T>& lhs, const vector<T>& rhs)
 {
-  if(lhs.getRow() != rhs.getSize())
+  if(lhs.getRow() != rhs.getSize() || lhs.getCol() != rhs.getSize())
   {
     throw std::out_of_range("VECTOR SIZE AND MATRIX DO NOT MATCH; SYM");
   }
 
   vector<T> temp(rhs.getSize());
-
-  for(int i = 0; i < lhs.getRow(); i++)
-  {
-    double sum = 0;
-    for(int j = 0; j < lhs.getCol(); j++)
-    {
-      sum += lhs(j, i) * rhs[j];
-    }
-    temp[i] = sum;
-  }
+  spmv(lhs.getRow(), lhs.column(0), rhs.data(), temp.data());
 
   return temp;
 }
@@ -0,0 +1,93 @@
+/**
+  * @file   taskgraph.h
+  * @author Dylan Warren, Section A
+  * @brief  A set of tasks and the order they must run in, run across a
+            ThreadPool with work stealing.
+*/
+/**
+  * @class  TaskGraph
+  * @brief  TaskGraph holds tasks and "before runs ahead of after" edges.
+  *         While it runs, every thread of the pool keeps its own deque of
+  *         ready tasks. A thread pushes the tasks it unblocks onto its own
+  *         deque and pops from the back, so the data it just wrote stays
+  *         in cache. A thread with nothing to do steals from the front of
+  *         another thread's deque.
+*/
+#ifndef TASKGRAPH_H
+#define TASKGRAPH_H
+
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+#include "./threadpool.h"
+
+class TaskGraph
+{
+  private:
+    // Task i runs m_work[i], then releases every task in m_after[i]
+    std::vector<std::function<void()>> m_work;
+    std::vector<std::vector<int>> m_after;
+    std::vector<int> m_needs;
+    /**
+      * @brief   Runs tasks for one thread until every task is done or one
+                  has thrown
+      * @pre     Called once per thread from run
+      * @post    None
+      * @param   self - Which deque belongs to this thread
+      * @param   threads - How many deques there are
+      * @param   ready - One deque of ready tasks per thread
+      * @param   locks - One lock per deque
+      * @param   waiting - Unfinished tasks each task still waits on
+      * @param   remaining - Tasks not yet finished
+      * @param   failed - Set once a task throws
+      * @param   error - The first exception a task threw
+      * @param   errorLock - Guards error
+      * @return  None
+    */
+    void work(const int self, const int threads, std::deque<int>* ready, std::mutex* locks,
+              std::atomic<int>* waiting, std::atomic<int>& remaining, std::atomic<bool>& failed,
+              std::exception_ptr& error, std::mutex& errorLock) const;
+  public:
+    /**
+      * @brief   Adds a task that waits on nothing yet
+      * @pre     None
+      * @post    The graph has one more task
+      * @param   work - What the task does
+      * @return  The task's id
+    */
+    int add(std::function<void()> work);
+    /**
+      * @brief   Makes after wait until before has finished
+      * @pre     before must have been added ahead of after, so the graph can
+                  never hold a cycle
+      * @post    None
+      * @param   before - Task to run first
+      * @param   after - Task to run once before is done
+      * @return  None
+      * @throw   If either id is not a task or before is not older than after
+    */
+    void depend(const int before, const int after);
+    /**
+      * @brief   Gets how many tasks there are
+      * @pre     None
+      * @post    None
+      * @return  Tasks added so far
+    */
+    int getSize() const { return static_cast<int>(m_work.size()); }
+    /**
+      * @brief   Runs every task once, each only after the tasks it depends on
+      * @pre     Tasks must not use pool
+      * @post    Every task has run, unless one threw
+      * @param   pool - Threads to run the tasks on
+      * @return  None
+      * @throw   The first exception a task threw, once the threads stop
+    */
+    void run(ThreadPool& pool = ThreadPool::global()) const;
+};
+
+#include "./taskgraph.hpp"
+
+#endif
@@ -0,0 +1,132 @@
+/**
+  * @file   taskgraph.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines TaskGraph functions
+*/
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+inline int TaskGraph::add(std::function<void()> work)
+{
+  m_work.push_back(std::move(work));
+  m_after.emplace_back();
+  m_needs.push_back(0);
+  return getSize() - 1;
+}
+
+inline void TaskGraph::depend(const int before, const int after)
+{
+  if(before < 0 || after >= getSize() || before >= after)
+  {
+    std::cerr << "A task can only wait on a task added before it" << std::endl;
+    throw std::out_of_range("BAD DEPENDENCY; TASK GRAPH");
+  }
+
+  m_after[before].push_back(after);
+  m_needs[after]++;
+}
+
+inline void TaskGraph::work(const int self, const int threads, std::deque<int>* ready,
+                            std::mutex* locks, std::atomic<int>* waiting,
+                            std::atomic<int>& remaining, std::atomic<bool>& failed,
+                            std::exception_ptr& error, std::mutex& errorLock) const
+{
+  while(remaining.load() > 0 && !failed.load())
+  {
+    // Newest task of our own deque first, then the oldest of a neighbour's
+    int task = -1;
+    for(int probe = 0; probe < threads && task < 0; probe++)
+    {
+      const int victim = (self + probe) % threads;
+      std::lock_guard<std::mutex> guard(locks[victim]);
+      if(!ready[victim].empty())
+      {
+        if(probe == 0)
+        {
+          task = ready[victim].back();
+          ready[victim].pop_back();
+        }
+        else
+        {
+          task = ready[victim].front();
+          ready[victim].pop_front();
+        }
+      }
+    }
+
+    if(task < 0)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    try
+    {
+      m_work[task]();
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> guard(errorLock);
+      if(!error)
+      {
+        error = std::current_exception();
+      }
+      failed.store(true);
+      return;
+    }
+
+    for(const int next : m_after[task])
+    {
+      if(--waiting[next] == 0)
+      {
+        std::lock_guard<std::mutex> guard(locks[self]);
+        ready[self].push_back(next);
+      }
+    }
+    remaining--;
+  }
+}
+
+inline void TaskGraph::run(ThreadPool& pool) const
+{
+  const int size = getSize();
+  if(size == 0)
+  {
+    return;
+  }
+
+  const int threads = pool.getThreads();
+  std::unique_ptr<std::deque<int>[]> ready(new std::deque<int>[threads]);
+  std::unique_ptr<std::mutex[]> locks(new std::mutex[threads]);
+  std::unique_ptr<std::atomic<int>[]> waiting(new std::atomic<int>[size]);
+  std::atomic<int> remaining(size);
+  std::atomic<bool> failed(false);
+  std::exception_ptr error;
+  std::mutex errorLock;
+
+  // Tasks that wait on nothing are dealt out to the threads in turn
+  int dealt = 0;
+  for(int i = 0; i < size; i++)
+  {
+    waiting[i].store(m_needs[i]);
+    if(m_needs[i] == 0)
+    {
+      ready[dealt++ % threads].push_back(i);
+    }
+  }
+
+  pool.parallelFor(0, threads, [&](const int first, const int last)
+  {
+    for(int self = first; self < last; self++)
+    {
+      work(self, threads, ready.get(), locks.get(), waiting.get(), remaining, failed,
+           error, errorLock);
+    }
+  });
+
+  if(error)
+  {
+    std::rethrow_exception(error);
+  }
+}
@@ -0,0 +1,126 @@
+/**
+  * @file   threadpool.h
+  * @author Dylan Warren, Section A
+  * @brief  A fixed set of worker threads for splitting loops across cores.
+*/
+/**
+  * @class  ThreadPool
+  * @brief  ThreadPool starts its workers once and keeps them waiting, so a
+  *         parallelFor costs a wake up instead of creating threads. The
+  *         calling thread works on the loop too. Loops from different
+  *         threads take turns, a loop started from inside a running loop
+  *         runs on the thread that started it.
+*/
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <exception>
+
+class ThreadPool
+{
+  private:
+    int m_threads;
+    std::unique_ptr<std::thread[]> m_workers;
+    std::mutex m_mutex;
+    // Held by the caller for a whole job, so only one job uses the state below
+    std::mutex m_runMutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    // The loop being run, split into m_chunks pieces
+    const std::function<void(int)>* m_job;
+    int m_chunks;
+    int m_next;
+    int m_remaining;
+    // First exception a chunk threw, rethrown by run
+    std::exception_ptr m_error;
+    unsigned long m_generation;
+    bool m_stop;
+    /**
+      * @brief   What each worker runs until the pool is destroyed
+      * @pre     None
+      * @post    None
+      * @return  None
+    */
+    void workerLoop();
+    /**
+      * @brief   Claims and runs chunks of the current job until none are left
+      * @pre     lock must hold m_mutex
+      * @post    lock still holds m_mutex
+      * @param   lock - Lock on m_mutex
+      * @param   generation - The job the chunks must belong to
+      * @return  None
+    */
+    void work(std::unique_lock<std::mutex>& lock, const unsigned long generation);
+    /**
+      * @brief   Counts the jobs the calling thread is inside of, on any pool
+      * @pre     None
+      * @post    None
+      * @return  Reference to the count of this thread
+    */
+    static int& depth();
+    /**
+      * @brief   Runs job(0) ... job(chunks - 1) across the pool and waits. A
+                  thread already inside a job runs every chunk itself.
+      * @pre     None
+      * @post    Every chunk has finished
+      * @param   job - Work for one chunk
+      * @param   chunks - How many chunks there are
+      * @return  None
+      * @throw   The first exception thrown by a chunk, once all have finished
+    */
+    void run(const std::function<void(int)>& job, const int chunks);
+  public:
+    /**
+      * @brief   Starts the workers
+      * @pre     threads must not be negative
+      * @post    threads - 1 workers wait for jobs, the caller is the last one
+      * @param   threads - Threads to use, 0 means one per core
+      * @return  None
+      * @throw   If threads is negative
+    */
+    ThreadPool(const int threads = 0);
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    /**
+      * @brief   Stops and joins the workers
+      * @pre     No parallelFor is running
+      * @post    None
+      * @return  None
+    */
+    ~ThreadPool();
+    /**
+      * @brief   Gets how many threads work on a loop, the caller included
+      * @pre     None
+      * @post    None
+      * @return  m_threads
+    */
+    int getThreads() const { return m_threads; }
+    /**
+      * @brief   Gets a pool shared by kernels that are not handed one
+      * @pre     None
+      * @post    The pool is started on first use, one thread per core
+      * @return  The shared pool
+    */
+    static ThreadPool& global();
+    /**
+      * @brief   Splits [begin, end) into one contiguous range per thread
+      * @pre     body must be safe to run on disjoint ranges at once
+      * @post    body has run on every index once
+      * @param   begin - First index
+      * @param   end - One past the last index
+      * @param   body - Called as body(first, last) for each range
+      * @return  None
+      * @throw   The first exception thrown by body
+    */
+    template<class Body>
+    void parallelFor(const int begin, const int end, Body body);
+};
+
+#include "./threadpool.hpp"
+
+#endif
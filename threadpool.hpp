@@ -0,0 +1,178 @@
+/**
+  * @file   threadpool.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines ThreadPool functions
+*/
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+
+inline ThreadPool::ThreadPool(const int threads)
+{
+  if(threads < 0)
+  {
+    std::cerr << "Thread count must not be negative" << std::endl;
+    throw std::out_of_range("BAD THREAD COUNT; THREAD POOL");
+  }
+
+  m_threads = threads;
+  if(m_threads == 0)
+  {
+    m_threads = static_cast<int>(std::thread::hardware_concurrency());
+    if(m_threads < 1)
+    {
+      m_threads = 1;
+    }
+  }
+
+  m_job = nullptr;
+  m_chunks = 0;
+  m_next = 0;
+  m_remaining = 0;
+  m_generation = 0;
+  m_stop = false;
+
+  if(m_threads > 1)
+  {
+    m_workers.reset(new std::thread[m_threads - 1]);
+    for(int i = 0; i < m_threads - 1; i++)
+    {
+      m_workers[i] = std::thread(&ThreadPool::workerLoop, this);
+    }
+  }
+}
+
+inline ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for(int i = 0; i < m_threads - 1; i++)
+  {
+    m_workers[i].join();
+  }
+}
+
+inline ThreadPool& ThreadPool::global()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+inline void ThreadPool::workerLoop()
+{
+  unsigned long seen = 0;
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(true)
+  {
+    m_wake.wait(lock, [&]{ return m_stop || m_generation != seen; });
+    if(m_stop)
+    {
+      return;
+    }
+    seen = m_generation;
+    work(lock, seen);
+  }
+}
+
+inline void ThreadPool::work(std::unique_lock<std::mutex>& lock,
+                             const unsigned long generation)
+{
+  // Chunks are handed out under the lock, so a worker that wakes late can
+  // never take a chunk of the next job
+  while(m_generation == generation && m_next < m_chunks)
+  {
+    const int chunk = m_next++;
+    const std::function<void(int)>& job = *m_job;
+    lock.unlock();
+    std::exception_ptr error;
+    depth()++;
+    try
+    {
+      job(chunk);
+    }
+    catch(...)
+    {
+      error = std::current_exception();
+    }
+    depth()--;
+    lock.lock();
+    if(error && !m_error)
+    {
+      m_error = error;
+    }
+    if(--m_remaining == 0)
+    {
+      m_done.notify_all();
+    }
+  }
+}
+
+inline int& ThreadPool::depth()
+{
+  thread_local int count = 0;
+  return count;
+}
+
+inline void ThreadPool::run(const std::function<void(int)>& job, const int chunks)
+{
+  // Waiting on the pool from inside one of its chunks would never end, and
+  // a chunk of another pool could wait on a job that waits on it
+  if(depth() > 0)
+  {
+    for(int chunk = 0; chunk < chunks; chunk++)
+    {
+      job(chunk);
+    }
+    return;
+  }
+
+  std::lock_guard<std::mutex> turn(m_runMutex);
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_job = &job;
+  m_chunks = chunks;
+  m_next = 0;
+  m_remaining = chunks;
+  m_error = nullptr;
+  const unsigned long generation = ++m_generation;
+  m_wake.notify_all();
+
+  work(lock, generation);
+  m_done.wait(lock, [&]{ return m_remaining == 0; });
+  m_job = nullptr;
+  m_chunks = 0;
+
+  std::exception_ptr error = m_error;
+  m_error = nullptr;
+  if(error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+template<class Body>
+void ThreadPool::parallelFor(const int begin, const int end, Body body)
+{
+  const int count = end - begin;
+  if(count <= 0)
+  {
+    return;
+  }
+
+  const int chunks = (count < m_threads ? count : m_threads);
+  if(chunks == 1)
+  {
+    body(begin, end);
+    return;
+  }
+
+  const std::function<void(int)> job = [&](const int chunk)
+  {
+    const long long first = begin + static_cast<long long>(count) * chunk / chunks;
+    const long long last = begin + static_cast<long long>(count) * (chunk + 1) / chunks;
+    body(static_cast<int>(first), static_cast<int>(last));
+  };
+  run(job, chunks);
+}
@@ -18,13 +18,13 @@ for size in sizes:
     times1.append(time_diff)
     print('With N = {} it took {} secs to run the program'.format(size,time_diff))
 
-# for size in sizes:
-#     t0 = time.time()
-#     os.system('./scaled {}'.format(size))
-#     t1 = time.time()
-#     time_diff = t1-t0
-#     times2.append(time_diff)
-#     print('With N = {} it took {} secs to run the program'.format(size,time_diff))
+for size in sizes:
+    t0 = time.time()
+    os.system('./driver {} {}'.format(size, 3))
+    t1 = time.time()
+    time_diff = t1-t0
+    times2.append(time_diff)
+    print('With N = {} multigrid took {} secs to run the program'.format(size,time_diff))
 
 plt.figure()
 df1 = pd.DataFrame(list(zip(sizes,times1)), columns=['N','times'])
@@ -36,6 +36,16 @@ plt.legend('cholesky')
 plt.savefig('lu_plot.png')
 plt.clf()
 
+df2 = pd.DataFrame(list(zip(sizes,times2)), columns=['N','times'])
+plt.plot(df1['N'],df1['times'], '--r')
+plt.plot(df2['N'],df2['times'], '--g')
+plt.title('Runtimes using Cholesky and Multigrid')
+plt.xlabel( 'N')
+plt.ylabel( 'Time Secs')
+plt.legend(['cholesky','multigrid'])
+plt.savefig('multigrid_plot.png')
+plt.clf()
+
 # df2 = pd.DataFrame(list(zip(sizes,times2)), columns=['N','times'])
 # plt.plot(df2['N'],df2['times'], '--g')
 # plt.title('Runtimes using Scaled')
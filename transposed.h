@@ -0,0 +1,78 @@
+/**
+  * @file   transposed.h
+  * @author Dylan Warren, Section A
+  * @brief  A read only transpose of a matrix that copies nothing.
+*/
+/**
+  * @class  TransposedView
+  * @brief  TransposedView keeps a pointer to its source and swaps col and
+  *         row on every access, so TransposedView<LowerTriangle<T>> reads as
+  *         the upper triangle L^T. The source must outlive the view.
+*/
+#ifndef TRANSPOSED_H
+#define TRANSPOSED_H
+
+#include <type_traits>
+#include <utility>
+
+template<class M>
+class TransposedView
+{
+  private:
+    const M* m_source;
+  public:
+    /** Entry type of the source */
+    using value_type = std::decay_t<decltype(std::declval<const M&>()(0, 0))>;
+    /**
+      * @brief   Views source as its transpose
+      * @pre     source must outlive the view
+      * @post    None
+      * @param   source - Matrix to view
+      * @return  None
+    */
+    explicit TransposedView(const M& source) : m_source(&source) {};
+    /**
+      * @brief   Gets the view's row size, the source's col size
+      * @pre     None
+      * @post    None
+      * @return  Cols of the source
+    */
+    int getRow() const { return m_source->getCol(); }
+    /**
+      * @brief   Gets the view's col size, the source's row size
+      * @pre     None
+      * @post    None
+      * @return  Rows of the source
+    */
+    int getCol() const { return m_source->getRow(); }
+    /**
+      * @brief   Reads an entry of the transpose
+      * @pre     col and row must be within bounds
+      * @post    None
+      * @param   col - column of the view
+      * @param   row - row of the view
+      * @return  The source entry at (row, col)
+    */
+    value_type operator()(const int col, const int row) const;
+    /**
+      * @brief   Gets the matrix being viewed
+      * @pre     None
+      * @post    None
+      * @return  The source
+    */
+    const M& source() const { return *m_source; }
+};
+
+/**
+  * @brief   Views source as its transpose without copying it
+  * @pre     source must outlive the view
+  * @post    None
+  * @param   source - Matrix to view
+  * @return  TransposedView of source
+*/
+template<class M>
+TransposedView<M> transposedView(const M& source);
+
+#include "./transposed.hpp"
+
+#endif
@@ -0,0 +1,18 @@
+/**
+  * @file   transposed.hpp
+  * @author Dylan Warren, Section A
+  * @brief  Defines the TransposedView accessors
+*/
+
+template<class M>
+typename TransposedView<M>::value_type TransposedView<M>::operator()(const int col,
+                                                                     const int row) const
+{
+  return (*m_source)(row, col);
+}
+
+template<class M>
+TransposedView<M> transposedView(const M& source)
+{
+  return TransposedView<M>(source);
+}
@@ -12,6 +12,8 @@
 #define UPPER_H
 
 #include "./matrix.h"
+#include "./aligned.h"
+#include "./blas.h"
 
 template <class T>
 class UpperTriangle : public matrix<UpperTriangle<T>, T>
@@ -19,33 +21,24 @@ class UpperTriangle : public matrix<UpperTriangle<T>, T>
   private:
     int m_rows;
     int m_cols;
-    vector<vector<T>> ptr_to_data;
+    // Packed by column, column col holds rows 0 .. col from col (col + 1) / 2
+    AlignedBuffer<T> ptr_to_data;
     /**
-      * @brief   Allows the ability to change the vector returned from using []
-      * @pre     index must be greater than or equal to zero and less than m_cols
-      * @post    The vector accessed is able to be changed
-      * @param   index - Used to access ptr_to_vector
-      * @return  A position in ptr_to_vector
-      * @throw   If index is lower than zero or larger than m_cols
-    */
-    vector<T>& operator[](const int index) { return ptr_to_data[index]; }
-  public:
-    /**
-      * @brief   Allows the ability to read from ptr_to_vector
-      * @pre     index must be greater than or equal to zero and less than m_cols
+      * @brief   Finds where a column starts in ptr_to_data
+      * @pre     None
       * @post    None
-      * @param   index - Used to access ptr_to_vector
-      * @return  A vector from ptr_to_vector
-      * @throw   If index is lower than zero or larger than m_cols
+      * @param   col - column of the matrix
+      * @return  Index of (col, 0)
     */
-    const vector<T>& operator[](const int index) const { return ptr_to_data[index]; }
+    static std::ptrdiff_t offset(const int col) { return static_cast<std::ptrdiff_t>(col) * (col + 1) / 2; }
+  public:
     /**
       * @brief   Sets row and col to 0 and sets our point to nullptr
       * @pre     None
       * @post    All member variables are set.
       * @return  None
     */
-    UpperTriangle() : m_rows(0), m_cols(0), ptr_to_data(vector<vector<T>>()) {};
+    UpperTriangle() : m_rows(0), m_cols(0), ptr_to_data(AlignedBuffer<T>()) {};
     /**
       * @brief   Confirms UpperTrianle row and col are proper values
                   then initialises ptr_to_vector
@@ -54,7 +47,8 @@ class UpperTriangle : public matrix<UpperTriangle<T>, T>
       * @param   r - How tall the UpperTrianle should be
       * @param   c - How many vectors wide it should be
       * @return  None
-      * @throw   If r or r is 0 or less
+      * @throw   If r or r is 0 or less or the triangle holds more
+                  values than an int counts
     */
     UpperTriangle(const int r, const int c);
     /**
@@ -123,6 +117,22 @@ class UpperTriangle : public matrix<UpperTriangle<T>, T>
       * @throw   If col or row are out of bounds
     */
     T& operator()(const int col, const int row);
+    /**
+      * @brief   Gets the stored part of a column, from row 0 to the diagonal
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, 0), row i is at [i]
+    */
+    T* column(const int col) { return ptr_to_data.data() + offset(col); }
+    /**
+      * @brief   Gets the stored part of a column, from row 0 to the diagonal
+      * @pre     col must be within bounds
+      * @post    None
+      * @param   col - column of the matrix
+      * @return  Pointer to (col, 0), row i is at [i]
+    */
+    const T* column(const int col) const { return ptr_to_data.data() + offset(col); }
 };
 
 /**
@@ -15,15 +15,7 @@ UpperTriangle<T>::UpperTriangle(const int r, const int c)
   m_rows = r;
   m_cols = c;
 
-  ptr_to_data = vector<vector<T>>(m_cols);
-
-  int rowReducer = m_rows-1;
-
-  for(int i = 0; i < m_cols; i++)
-  {
-    ptr_to_data[i] = vector<T>(m_rows - rowReducer);
-    rowReducer--;
-  }
+  ptr_to_data = AlignedBuffer<T>(offset(m_cols));
 }
 
 template<typename T>
@@ -74,30 +66,35 @@ template<typename T>
 UpperTriangle<T> operator*(const UpperTriangle<T>& lhs, 
                             const UpperTriangle<T>& rhs)
 {
-  if(lhs.getCol() != rhs.getRow())
+  if(lhs.getCol() != rhs.getRow() || lhs.getRow() != lhs.getCol() || rhs.getRow() != rhs.getCol())
   {
     std::cerr << "lhs column doesn't match rhs row size" << std::endl;
     throw std::out_of_range("MISMATCHED SIZES");
   }
 
-  UpperTriangle<T> temp(lhs.getRow(), rhs.getCol());
-  vector<T> rowVec(lhs.getCol());
-
-  for(int row = 0; row < lhs.getRow(); row++)
+  // rhs is spread into a zeroed n by n block, tpmm turns it into lhs rhs
+  // and the upper half of the block is the product
+  const int n = lhs.getRow();
+  AlignedBuffer<T> work(static_cast<std::ptrdiff_t>(n) * n);
+  T* w = work.data();
+  for(int col = 0; col < n; col++)
   {
-    for(int k = 0; k < lhs.getCol(); k++)
+    const T* r = rhs.column(col);
+    for(int i = 0; i <= col; i++)
     {
-      rowVec[k] = lhs(k, row);
+      w[col * n + i] = r[i];
     }
+  }
 
-    for(int col = row; col < lhs.getCol(); col++)
+  tpmm(UPPER_TRIANGLE, NO_TRANSPOSE, n, lhs.column(0), n, w, n);
+
+  UpperTriangle<T> temp(n, n);
+  for(int col = 0; col < n; col++)
+  {
+    T* t = temp.column(col);
+    for(int i = 0; i <= col; i++)
     {
-      double sum = 0;
-      for(int i = row; i <= col; i++)
-      {
-        sum += rowVec[i] * rhs(col, i);
-      }
-      temp(col, row) = sum;
+      t[i] = w[col * n + i];
     }
   }
 
@@ -107,32 +104,14 @@ UpperTriangle<T> operator*(const UpperTriangle<T>& lhs,
 template<typename T>
 vector<T> operator*(const UpperTriangle<T>& lhs, const vector<T>& rhs)
 {
-  if(lhs.getCol() != rhs.getSize())
+  if(lhs.getCol() != rhs.getSize() || lhs.getRow() != lhs.getCol())
   {
     std::cerr << "upper col does not match vector size" << std::endl;
     throw std::out_of_range("MISMATCHED SIZES");
   }
 
-  vector<T> rowVec(rhs.getSize());
-  vector<T> temp(rhs.getSize());
-
-  for(int row = 0; row < lhs.getRow(); row++)
-  {
-    for(int k = 0; k < lhs.getCol(); k++)
-    {
-      rowVec[k] = lhs(k, row);
-    }
-
-    for(int col = row; col < lhs.getCol(); col++)
-    {
-      double sum = 0;
-      for(int i = row; i <= col; i++)
-      {
-        sum += rowVec[i] * rhs[i];
-      }
-      temp[row] = sum;
-    }
-  }
+  vector<T> temp(rhs);
+  tpmv(UPPER_TRIANGLE, NO_TRANSPOSE, lhs.getRow(), lhs.column(0), temp.data());
 
   return temp;
 }
@@ -143,6 +122,7 @@ T UpperTriangle<T>::operator()(const int col, const int row) const
   if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
   {
     std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; UPPER");
   }
 
   if(col < row)
@@ -150,7 +130,7 @@ T UpperTriangle<T>::operator()(const int col, const int row) const
     return 0;
   }
 
-  return ptr_to_data[col][row];
+  return ptr_to_data.data()[offset(col) + row];
 }
 
 template<typename T>
@@ -159,6 +139,7 @@ T& UpperTriangle<T>::operator()(const int col, const int row)
   if(col < 0 || col >= m_cols || row < 0 || row >= m_rows)
   {
     std::cerr << "Out of bounds () call" << std::endl;
+    throw std::out_of_range("OUT OF BOUNDS; UPPER");
   }
 
   if(col < row)
@@ -167,7 +148,7 @@ T& UpperTriangle<T>::operator()(const int col, const int row)
     throw std::out_of_range("Tried to set 0 to a value");
   }
 
-  return ptr_to_data[col][row];
+  return ptr_to_data.data()[offset(col) + row];
 }
 
 template<typename T>
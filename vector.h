@@ -93,6 +93,20 @@ public:
     * @return  Returns m_size
   */
   int getSize() const { return m_size; }
+  /**
+    * @brief   Gets the raw storage for loops that do their own bounds checks
+    * @pre     None
+    * @post    The data may be changed through the pointer
+    * @return  Pointer to the first element, nullptr if the vector is empty
+  */
+  T* data() { return ptr_to_data.get(); }
+  /**
+    * @brief   Gets the raw storage for loops that do their own bounds checks
+    * @pre     None
+    * @post    None
+    * @return  Pointer to the first element, nullptr if the vector is empty
+  */
+  const T* data() const { return ptr_to_data.get(); }
 };
 
 /**
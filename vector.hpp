@@ -60,7 +60,6 @@ template<typename T>
 vector<T>& vector<T>::operator=(vector<T>&& other)
 {
   m_size = other.m_size;
-  ptr_to_data.reset(new T[m_size]);
   ptr_to_data = std::move(other.ptr_to_data);
 
   // Release the data pointer from the source object so that